@@ -4,99 +4,9 @@ struct AUTOGAINData final {
     const VSVideoInfo* vi;
     VSNode* node;
     bool process_p[3];
-    void (*process)(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+    AutoGainFunc process;
 };
 
-extern void autogainUC_avx2(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
-template <const uint16_t peak>
-extern void autogainUS_avx2(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
-extern void autogainF_avx2(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
-
-void minmaxUC_c(const uint8_t* VS_RESTRICT srcp, uint8_t& dst_min, uint8_t& dst_max, ptrdiff_t stride, const int w, const int h) noexcept {
-    uint8_t imin = UCHAR_MAX;
-    uint8_t imax = 0;
-    for (int y{0}; y < h; y++) {
-        for (int x{0}; x < w; x++) {
-            uint8_t v = srcp[x];
-            imin = VSMIN(imin, v);
-            imax = VSMAX(imax, v);
-        }
-        srcp += stride;
-    }
-    dst_min = imin;
-    dst_max = imax;
-}
-
-void minmaxUS_c(const uint8_t* VS_RESTRICT srcp, uint16_t& dst_min, uint16_t& dst_max, ptrdiff_t stride, const int w, const int h) noexcept {
-    uint16_t imin = USHRT_MAX;
-    uint16_t imax = 0;
-    for (int y{0}; y < h; y++) {
-        for (int x{0}; x < w; x++) {
-            uint16_t v = ((const uint16_t*)srcp)[x];
-            imin = VSMIN(imin, v);
-            imax = VSMAX(imax, v);
-        }
-        srcp += stride;
-    }
-    dst_min = imin;
-    dst_max = imax;
-}
-
-void minmaxF_c(const uint8_t* VS_RESTRICT srcp, float& dst_min, float& dst_max, ptrdiff_t stride, const int w, const int h) noexcept {
-    float imin = 1.0f;
-    float imax = 0.0f;
-    for (int y{0}; y < h; y++) {
-        for (int x{0}; x < w; x++) {
-            float v = ((const float*)srcp)[x];
-            imin = VSMIN(imin, v);
-            imax = VSMAX(imax, v);
-        }
-        srcp += stride;
-    }
-    dst_min = imin;
-    dst_max = imax;
-}
-
-void autogainUC_c(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept {
-    uint8_t pmin, pmax;
-    minmaxUC_c(srcp, pmin, pmax, stride, w, h);
-    for (int y{0}; y < h; y++) {
-        for (int x{0}; x < w; x++) {
-            uint8_t v = srcp[x];
-            dstp[x] = (uint8_t)(((v - pmin) / (float)(pmax - pmin)) * 255 + 0.5f);
-        }
-        srcp += stride;
-        dstp += stride;
-    }
-}
-
-template <const uint16_t peak>
-void autogainUS_c(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept {
-    uint16_t pmin, pmax;
-    minmaxUS_c(srcp, pmin, pmax, stride, w, h);
-    for (int y{0}; y < h; y++) {
-        for (int x{0}; x < w; x++) {
-            uint16_t v = ((const uint16_t*)srcp)[x];
-            ((uint16_t*)dstp)[x] = (uint16_t)(((v - pmin) / (float)(pmax - pmin)) * peak + 0.5f);
-        }
-        srcp += stride;
-        dstp += stride;
-    }
-}
-
-void autogainF_c(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept {
-    float pmin, pmax;
-    minmaxF_c(srcp, pmin, pmax, stride, w, h);
-    for (int y{0}; y < h; y++) {
-        for (int x{0}; x < w; x++) {
-            float v = ((const float*)srcp)[x];
-            ((float*)dstp)[x] = (v - pmin) / (pmax - pmin);
-        }
-        srcp += stride;
-        dstp += stride;
-    }
-}
-
 static const VSFrame* VS_CC autogainGetFrame(int n, int activationReason, void* instanceData, void** frameData, VSFrameContext* frameCtx, VSCore* core, const VSAPI* vsapi) {
     auto d{static_cast<AUTOGAINData*>(instanceData)};
 
@@ -173,49 +83,12 @@ void VS_CC autogainCreate(const VSMap* in, VSMap* out, void* userData, VSCore* c
         }
     }
 
-#ifdef PLUGIN_X86
-    switch (d->vi->format.bitsPerSample) {
-        case 8:
-            d->process = (instrset_detect() >= 8) ? autogainUC_avx2 : autogainUC_c;
-            break;
-        case 10:
-            d->process = (instrset_detect() >= 8) ? autogainUS_avx2<1023> : autogainUS_c<1023>;
-            break;
-        case 12:
-            d->process = (instrset_detect() >= 8) ? autogainUS_avx2<4095> : autogainUS_c<4095>;
-            break;
-        case 14:
-            d->process = (instrset_detect() >= 8) ? autogainUS_avx2<16383> : autogainUS_c<16383>;
-            break;
-        case 16:
-            d->process = (instrset_detect() >= 8) ? autogainUS_avx2<65535> : autogainUS_c<65535>;
-            break;
-        case 32:
-            d->process = (instrset_detect() >= 8) ? autogainF_avx2 : autogainF_c;
-            break;
-    }
-#else
-    switch (d->vi->format.bitsPerSample) {
-        case 8:
-            d->process = autogainUC_c;
-            break;
-        case 10:
-            d->process = autogainUS_c<1023>;
-            break;
-        case 12:
-            d->process = autogainUS_c<4095>;
-            break;
-        case 14:
-            d->process = autogainUS_c<16383>;
-            break;
-        case 16:
-            d->process = autogainUS_c<65535>;
-            break;
-        case 32:
-            d->process = autogainF_c;
-            break;
+    d->process = select_autogain(d->vi->format.bitsPerSample);
+    if (!d->process) {
+        vsapi->mapSetError(out, "AutoGain: only 8, 10, 12, 14, 16 bit integer and 32 bit float formats are supported");
+        vsapi->freeNode(d->node);
+        return;
     }
-#endif
 
     VSFilterDependency deps[] = {{d->node, rpGeneral}};
     vsapi->createVideoFilter(out, "AutoGain", d->vi, autogainGetFrame, autogainFree, fmParallel, deps, 1, d.get(), core);
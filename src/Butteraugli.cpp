@@ -1,17 +1,75 @@
+#include <jxl/thread_parallel_runner.h>
+
 #include "shared.h"
 
+// JxlThreadParallelRunners of an instance. A runner can't run two jobs at once, so every frame in flight takes
+// its own: at most one is created per frame processed at the same time.
+class RunnerPool final {
+    std::mutex mutex;
+    std::vector<void*> runners;
+    std::vector<void*> idle;
+    int threads = 1;
+
+   public:
+    RunnerPool() = default;
+    ~RunnerPool() {
+        for (void* runner : runners)
+            JxlThreadParallelRunnerDestroy(runner);
+    }
+    RunnerPool(const RunnerPool&) = delete;
+    RunnerPool& operator=(const RunnerPool&) = delete;
+
+    void set_threads(int n) noexcept { threads = n; }
+
+    // Returns nullptr when the runner can't be created.
+    void* acquire() noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!idle.empty()) {
+            void* runner = idle.back();
+            idle.pop_back();
+            return runner;
+        }
+
+        void* runner = JxlThreadParallelRunnerCreate(nullptr, threads);
+        if (runner)
+            runners.push_back(runner);
+        return runner;
+    }
+
+    void release(void* runner) noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        idle.push_back(runner);
+    }
+};
+
 struct BUTTERAUGLIData final {
     VSNode* node;
-    VSNode* node2;
+    std::vector<VSNode*> node2;
     const VSVideoInfo* vi;
+    VSVideoInfo vi_out;
     jxl::ButteraugliParams ba_params;
     double qnorm_val;
     bool distmap;
     bool heatmap;
     bool linput;
+    int threads;
+    int strip;      // rows per strip of the low memory mode, 0 when disabled, else at least kMinStripRows
+    int blocksize;  // side of the pooled diff map blocks, 0 when disabled
+    bool memo;      // scores are looked up in the score cache, only when no map is produced
+    uint64_t params_hash;
+    std::shared_ptr<ScoreFile> score_file;  // cache_path, shared with other instances using the same file
+    std::shared_ptr<MetricLog> log;
+    double gate_psnr;  // pairs at least this close are not scored and get no score props, 0 when disabled
+    int downscale;     // 1, 2 or 4
+    MetricRegion region;
+    SSERowFunc sse_row;
+    RunnerPool runners;  // used when threads > 1
+    FrameSelection selection;
+    MemoryStats memory;  // declared before workspaces, it must outlive them
+    WorkspacePool workspaces;
 
     void (*hmap)(VSFrame* dst, const jxl::ImageF& heatmap, int width, int height, const VSAPI* vsapi) noexcept;
-    void (*fill)(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept;
+    FillFunc fill;
 };
 
 template <typename pixel_t, int peak>
@@ -51,94 +109,374 @@ static void heatmapF(VSFrame* dst, const jxl::ImageF& heatmap, int width, int he
     }
 }
 
-static void compute_norms(const jxl::ImageF& diff_map, double& norm_q, double& norm3, double& norm_inf, double q) {
-    double sum_q = 0.0;    // Sum of q-powers for q-norm
-    double sum3 = 0.0;     // Sum of cubes for L3-norm
-    double max_val = 0.0;  // For L∞-norm (max)
+void accumulate_norms(const jxl::ImageF& diff_map, int y0, int y1, double q, NormAccumulator& acc) noexcept {
+    accumulate_norms(diff_map.ConstRow(y0), diff_map.bytes_per_row(), diff_map.xsize(), y1 - y0, q, acc);
+}
 
-    const int w = diff_map.xsize();
-    const int h = diff_map.ysize();
-    const int N = w * h;
+ButteraugliNorms compute_norms(const jxl::ImageF& diff_map, double q) noexcept {
+    NormAccumulator acc;
+    accumulate_norms(diff_map, 0, diff_map.ysize(), q, acc);
+    return finish_norms(acc, q);
+}
 
-    if (N == 0) {
-        norm_q = norm3 = norm_inf = 0.0;
-        return;
+// Even band starts keep the 2x2 grid of the half resolution pass aligned with the full frame.
+void make_bands(int height, int num_bands, std::vector<ButteraugliBand>& bands) {
+    const int rows = (((height + num_bands - 1) / num_bands) + 1) & ~1;
+    bands.resize((height + rows - 1) / rows);
+
+    int y0 = 0;
+    for (ButteraugliBand& band : bands) {
+        band.y0 = y0;
+        band.y1 = std::min(y0 + rows, height);
+        band.top = std::max(y0 - kBandOverlap, 0);
+        band.bottom = std::min(band.y1 + kBandOverlap, height);
+        y0 += rows;
     }
+}
 
-    for (int y = 0; y < h; ++y) {
-        const float* row = diff_map.Row(y);
-        for (int x = 0; x < w; ++x) {
-            const double val = std::abs(row[x]);
+static jxl::Status copy_band(const jxl::Image3F& src, jxl::Image3F& dst, int top, int bottom) {
+    const size_t width = src.xsize();
+    JXL_RETURN_IF_ERROR(ensure_size(src.memory_manager(), dst, width, bottom - top));
 
-            sum_q += std::pow(val, q);
-            sum3 += val * val * val;
-            if (val > max_val) max_val = val;
+    for (int c = 0; c < 3; c++) {
+        for (int y = top; y < bottom; y++) {
+            memcpy(dst.PlaneRow(c, y - top), src.ConstPlaneRow(c, y), width * sizeof(float));
         }
     }
+    return true;
+}
+
+struct BandTask final {
+    const std::function<jxl::Status(ButteraugliBand&)>* func;
+    std::vector<ButteraugliBand>* bands;
+    std::atomic<bool> failed{false};
+};
+
+static JxlParallelRetCode band_init(void* opaque, size_t num_threads) {
+    return JXL_PARALLEL_RET_SUCCESS;
+}
+
+static void band_run(void* opaque, uint32_t value, size_t thread_id) {
+    auto task{static_cast<BandTask*>(opaque)};
+    if (!(*task->func)((*task->bands)[value]))
+        task->failed = true;
+}
+
+// The runner hands out bands to its workers one at a time, so faster workers pick up the remaining ones.
+static bool run_bands(void* runner, std::vector<ButteraugliBand>& bands, const std::function<jxl::Status(ButteraugliBand&)>& func) {
+    BandTask task;
+    task.func = &func;
+    task.bands = &bands;
+
+    if (JxlThreadParallelRunner(runner, &task, band_init, band_run, 0, static_cast<uint32_t>(bands.size())) != JXL_PARALLEL_RET_SUCCESS)
+        return false;
+    return !task.failed;
+}
+
+bool band_references(void* runner, const jxl::ButteraugliParams& params, std::vector<ButteraugliBand>& bands, const jxl::Image3F& ref) {
+    return run_bands(runner, bands, [&](ButteraugliBand& band) -> jxl::Status {
+        JXL_RETURN_IF_ERROR(copy_band(ref, band.ref, band.top, band.bottom));
+        JXL_ASSIGN_OR_RETURN(band.comparator, jxl::ButteraugliComparator::Make(band.ref, params));
+        return true;
+    });
+}
+
+bool band_diffmap(void* runner, std::vector<ButteraugliBand>& bands, const jxl::Image3F& dist, jxl::ImageF& diff_map) {
+    if (diff_map.xsize() != dist.xsize() || diff_map.ysize() != dist.ysize()) {
+        auto res = jxl::ImageF::Create(dist.memory_manager(), dist.xsize(), dist.ysize());
+        if (!res.ok())
+            return false;
+        diff_map = std::move(res).value_();
+    }
+
+    return run_bands(runner, bands, [&](ButteraugliBand& band) -> jxl::Status {
+        JXL_RETURN_IF_ERROR(copy_band(dist, band.dist, band.top, band.bottom));
+        JXL_RETURN_IF_ERROR(band.comparator->Diffmap(band.dist, band.diff_map));
+        for (int y = band.y0; y < band.y1; y++) {
+            memcpy(diff_map.Row(y), band.diff_map.ConstRow(y - band.top), dist.xsize() * sizeof(float));
+        }
+        return true;
+    });
+}
+
+// The strips are bands compared one after the other, the reference side of a strip is built once for all clips.
+bool strip_compare(int width, int height, int strip, const std::vector<int>& clips, const jxl::ButteraugliParams& params, MetricWorkspace& ws, const StripFill& fill, const StripRows& rows, std::string& error) {
+    JxlMemoryManager* mm = ws.scratch.memory_manager;
+    ButteraugliBand& s = ws.strip;
+
+    make_bands(height, (height + strip - 1) / strip, ws.bands);
+
+    for (const ButteraugliBand& band : ws.bands) {
+        const int band_rows = band.bottom - band.top;
+        if (!ensure_size(mm, s.ref, width, band_rows) || !ensure_size(mm, s.dist, width, band_rows)) {
+            error = "Failed to allocate image";
+            return false;
+        }
+
+        if (!fill(s.ref, -1, band.top, band_rows)) {
+            error = ws.fill.error;
+            return false;
+        }
+        s.comparator.reset();
+        auto comparator_res = jxl::ButteraugliComparator::Make(s.ref, params);
+        if (!comparator_res.ok()) {
+            error = "Failed to create the reference comparator";
+            return false;
+        }
+        s.comparator = std::move(comparator_res).value_();
 
-    norm_q = std::pow(sum_q / N, 1.0 / q);
-    norm3 = std::pow(sum3 / N, 1.0 / 3.0);
-    norm_inf = max_val;  // Maximum absolute value (L∞-norm)
+        for (int i : clips) {
+            if (!fill(s.dist, i, band.top, band_rows)) {
+                error = ws.fill.error;
+                return false;
+            }
+            if (!s.comparator->Diffmap(s.dist, s.diff_map)) {
+                error = "ButteraugliInterface failed";
+                return false;
+            }
+            rows(i, s.diff_map, band.top, band.y0, band.y1);
+        }
+    }
+    return true;
+}
+
+// Low memory path, straight from the source frames. The full diff map is only assembled when it's returned as
+// distmap or heatmap, blocks are pooled strip by strip. The pending clips of ws.frame are scored into its norms.
+static bool strip_norms(BUTTERAUGLIData* d, const VSFrame* src, int width, int height, MetricWorkspace& ws, bool maps, std::string& error, const VSAPI* vsapi) {
+    FrameScratch& f = ws.frame;
+
+    if (maps && (ws.diff_map.xsize() != static_cast<size_t>(width) || ws.diff_map.ysize() != static_cast<size_t>(height))) {
+        auto res = jxl::ImageF::Create(ws.scratch.memory_manager, width, height);
+        if (!res.ok()) {
+            error = "Failed to allocate image";
+            return false;
+        }
+        ws.diff_map = std::move(res).value_();
+    }
+
+    auto fill = [&](jxl::Image3F& img, int clip, int top, int rows) {
+        return d->fill(img, (clip < 0) ? src : f.src2[clip], d->region.left, d->region.top + top * d->downscale, width, rows, ws.fill, vsapi);
+    };
+
+    auto add_rows = [&](int clip, const jxl::ImageF& map, int map_top, int y0, int y1) {
+        accumulate_norms(map, y0 - map_top, y1 - map_top, d->qnorm_val, f.acc[clip]);
+        if (!f.blocks.empty())
+            f.blocks[clip].add_rows(map, map_top, y0, y1);
+
+        if (maps) {
+            for (int y = y0; y < y1; y++) {
+                memcpy(ws.diff_map.Row(y), map.ConstRow(y - map_top), width * sizeof(float));
+            }
+        }
+    };
+
+    if (!strip_compare(width, height, d->strip, f.pending, d->ba_params, ws, fill, add_rows, error))
+        return false;
+
+    for (int i : f.pending)
+        f.norms[i] = finish_norms(f.acc[i], d->qnorm_val);
+    return true;
+}
+
+void set_butteraugli_norms(VSMap* props, const ButteraugliNorms& norms, int index, const VSAPI* vsapi) noexcept {
+    const std::string suffix = (index < 0) ? "" : "_" + std::to_string(index);
+
+    vsapi->mapSetFloat(props, ("_BUTTERAUGLI_QNorm" + suffix).c_str(), norms.norm_q, maReplace);
+    vsapi->mapSetFloat(props, ("_BUTTERAUGLI_3Norm" + suffix).c_str(), norms.norm3, maReplace);
+    vsapi->mapSetFloat(props, ("_BUTTERAUGLI_INFNorm" + suffix).c_str(), norms.norm_inf, maReplace);
+    vsapi->mapSetFloat(props, ("_BUTTERAUGLI_P95" + suffix).c_str(), norms.p95, maReplace);
+    vsapi->mapSetFloat(props, ("_BUTTERAUGLI_P99" + suffix).c_str(), norms.p99, maReplace);
 }
 
 static const VSFrame* VS_CC butteraugliGetFrame(int n, int activationReason, void* instanceData, void** frameData, VSFrameContext* frameCtx, VSCore* core, const VSAPI* vsapi) {
     auto d{static_cast<BUTTERAUGLIData*>(instanceData)};
 
     if (activationReason == arInitial) {
+        // Frames that aren't scored only need the distorted frame they pass through.
+        if (!d->selection.contains(n)) {
+            vsapi->requestFrameFilter(n, d->node2[0], frameCtx);
+            return nullptr;
+        }
+
         vsapi->requestFrameFilter(n, d->node, frameCtx);
-        vsapi->requestFrameFilter(n, d->node2, frameCtx);
+        for (auto node2 : d->node2)
+            vsapi->requestFrameFilter(n, node2, frameCtx);
     } else if (activationReason == arAllFramesReady) {
-        const VSFrame* src = vsapi->getFrameFilter(n, d->node, frameCtx);
-        const VSFrame* src2 = vsapi->getFrameFilter(n, d->node2, frameCtx);
+        if (!d->selection.contains(n))
+            return vsapi->getFrameFilter(n, d->node2[0], frameCtx);
 
-        int width = vsapi->getFrameWidth(src2, 0);
-        int height = vsapi->getFrameHeight(src2, 0);
-        const ptrdiff_t stride = vsapi->getStride(src2, 0) / d->vi->format.bytesPerSample;
+        MemoryBudgetGuard budget(d->memory);
 
-        jxl::CodecInOut ref{get_memory_manager()};
-        jxl::CodecInOut dist{get_memory_manager()};
-        jxl::ImageF diff_map;
+        // The per-frame lists and images all come from the workspace, sized by earlier frames.
+        MetricWorkspace* ws = d->workspaces.acquire();
+        FrameScratch& f = ws->frame;
+        const int num_dist = static_cast<int>(d->node2.size());
+        f.reset(num_dist);
 
-        if (!ref.SetSize(width, height) || !dist.SetSize(width, height)) {
-            vsapi->setFilterError("Butteraugli: Failed to set image size", frameCtx);
+        const VSFrame* src = vsapi->getFrameFilter(n, d->node, frameCtx);
+        for (int i = 0; i < num_dist; i++)
+            f.src2[i] = vsapi->getFrameFilter(n, d->node2[i], frameCtx);
+
+        void* runner = nullptr;
+
+        auto free_frames = [&]() {
             vsapi->freeFrame(src);
-            vsapi->freeFrame(src2);
-            return nullptr;
+            for (auto frame : f.src2)
+                vsapi->freeFrame(frame);
+            d->workspaces.release(ws);
+            if (runner)
+                d->runners.release(runner);
+        };
+
+        // The metric runs on the region, area-averaged with downscale. fill reads both straight from the frames.
+        int width = d->region.width / d->downscale;
+        int height = d->region.height / d->downscale;
+
+        // Identical pairs, pairs that were scored before and pairs under the PSNR gate skip the comparison,
+        // f.pending lists the others.
+        int memoized = 0;
+
+        const bool hashed = d->memo || d->score_file;
+        const uint64_t ref_hash = hashed ? frame_hash(src, vsapi) : 0;
+
+        for (int i = 0; i < num_dist; i++) {
+            double cached[5];
+
+            if (hashed) {
+                f.dist_hash[i] = frame_hash(f.src2[i], vsapi);
+
+                if (f.dist_hash[i] == ref_hash && frames_equal(src, f.src2[i], vsapi)) {
+                    f.norms[i] = ButteraugliNorms{};
+                    memoized++;
+                    continue;
+                }
+                if ((d->memo && score_cache_lookup({ref_hash, f.dist_hash[i], d->params_hash}, cached, 5)) ||
+                    (d->score_file && score_file_lookup(*d->score_file, {ref_hash, f.dist_hash[i], d->params_hash}, cached, 5))) {
+                    f.norms[i] = {cached[0], cached[1], cached[2], cached[3], cached[4]};
+                    memoized++;
+                    continue;
+                }
+            }
+
+            if (d->gate_psnr > 0.0) {
+                f.psnr[i] = frame_psnr(src, f.src2[i], d->region, d->sse_row, vsapi);
+                if (f.psnr[i] >= d->gate_psnr) {
+                    // No score at all, so aggregates can't mistake a skipped pair for a perfect one.
+                    const double nan = std::numeric_limits<double>::quiet_NaN();
+                    f.norms[i] = {nan, nan, nan, nan, nan};
+                    f.gated[i] = true;
+                    continue;
+                }
+            }
+
+            f.pending.push_back(i);
         }
 
-        d->fill(ref, dist, src, src2, width, height, vsapi);
+        // Strips don't use the full frame images of the workspace.
+        const bool stripped = d->strip && width >= 8 && height >= 8;
+        const bool full = !stripped && !f.pending.empty();
 
-        // Butteraugli expects linear RGB
-        if (!d->linput) {
-            if (!ref.Main().TransformTo(jxl::ColorEncoding::LinearSRGB(false), *JxlGetDefaultCms()) ||
-                !dist.Main().TransformTo(jxl::ColorEncoding::LinearSRGB(false), *JxlGetDefaultCms())) {
-                vsapi->setFilterError("Butteraugli: Failed to transform to Linear SRGB", frameCtx);
-                vsapi->freeFrame(src);
-                vsapi->freeFrame(src2);
+        if (full && !ws->ensure_images(width, height)) {
+            vsapi->setFilterError("Butteraugli: Failed to allocate image", frameCtx);
+            free_frames();
+            return nullptr;
+        }
+        jxl::ImageF& diff_map = ws->diff_map;
+        f.blocks.resize(d->blocksize ? num_dist : 0);
+        for (auto& b : f.blocks)
+            b.init(d->blocksize, width, height);
+
+        if (stripped) {
+            // Maps and blocks rule out the cache and the gate, so the pending clips are all the clips whenever they're used.
+            std::string error;
+            if (!f.pending.empty() && !strip_norms(d, src, width, height, *ws, d->distmap || d->heatmap, error, vsapi)) {
+                vsapi->setFilterError(("Butteraugli: " + error).c_str(), frameCtx);
+                free_frames();
                 return nullptr;
             }
-        }
+        } else if (full) {
+            jxl::Image3F& ref = ws->ref;
 
-        double score;
-        if (!jxl::ButteraugliInterface(*ref.Main().color(), *dist.Main().color(), d->ba_params, diff_map, score)) {
-            vsapi->setFilterError("Butteraugli: ButteraugliInterface failed", frameCtx);
-            vsapi->freeFrame(src);
-            vsapi->freeFrame(src2);
-            return nullptr;
+            // Butteraugli expects linear RGB, fill takes care of the conversion.
+            if (!d->fill(ref, src, d->region.left, d->region.top, width, height, ws->fill, vsapi)) {
+                vsapi->setFilterError((std::string("Butteraugli: ") + ws->fill.error).c_str(), frameCtx);
+                free_frames();
+                return nullptr;
+            }
+
+            // The reference side of the comparison (opsin dynamics, frequency split and masking) only depends on the
+            // reference frame, so it's built once and reused for every distorted clip.
+            // Images smaller than 8x8 are left to ButteraugliInterface, which pads them internally.
+            std::unique_ptr<jxl::ButteraugliComparator> comparator;
+            // Bands are at least kMinBandRows high, so the overlap never costs more than half of the work.
+            const int num_bands = std::min(d->threads, height / kMinBandRows);
+            const bool banded = num_bands > 1 && width >= 8;
+            if (banded) {
+                runner = d->runners.acquire();
+                if (!runner) {
+                    vsapi->setFilterError("Butteraugli: Failed to create the thread pool", frameCtx);
+                    free_frames();
+                    return nullptr;
+                }
+
+                make_bands(height, num_bands, ws->bands);
+                if (!band_references(runner, d->ba_params, ws->bands, ref)) {
+                    vsapi->setFilterError("Butteraugli: Failed to create the reference comparator", frameCtx);
+                    free_frames();
+                    return nullptr;
+                }
+            } else if (width >= 8 && height >= 8) {
+                auto comparator_res = jxl::ButteraugliComparator::Make(ref, d->ba_params);
+                if (!comparator_res.ok()) {
+                    vsapi->setFilterError("Butteraugli: Failed to create the reference comparator", frameCtx);
+                    free_frames();
+                    return nullptr;
+                }
+                comparator = std::move(comparator_res).value_();
+            }
+
+            for (int i : f.pending) {
+                jxl::Image3F& dist = ws->dist;
+                if (!d->fill(dist, f.src2[i], d->region.left, d->region.top, width, height, ws->fill, vsapi)) {
+                    vsapi->setFilterError((std::string("Butteraugli: ") + ws->fill.error).c_str(), frameCtx);
+                    free_frames();
+                    return nullptr;
+                }
+
+                bool ok;
+                if (banded) {
+                    ok = band_diffmap(runner, ws->bands, dist, diff_map);
+                } else if (comparator) {
+                    ok = !!comparator->Diffmap(dist, diff_map);
+                } else {
+                    double score;
+                    ok = jxl::ButteraugliInterface(ref, dist, d->ba_params, diff_map, score);
+                }
+
+                if (!ok) {
+                    vsapi->setFilterError("Butteraugli: ButteraugliInterface failed", frameCtx);
+                    free_frames();
+                    return nullptr;
+                }
+
+                f.norms[i] = compute_norms(diff_map, d->qnorm_val);
+                if (!f.blocks.empty())
+                    f.blocks[i].add_rows(diff_map, 0, 0, height);
+            }
         }
 
-        double norm_q, norm3, norm_inf;
-        compute_norms(diff_map, norm_q, norm3, norm_inf, d->qnorm_val);
+        for (int i : f.pending) {
+            const ButteraugliNorms& norms = f.norms[i];
+            const double scores[5] = {norms.norm_q, norms.norm3, norms.norm_inf, norms.p95, norms.p99};
+            if (d->memo)
+                score_cache_insert({ref_hash, f.dist_hash[i], d->params_hash}, scores, 5);
+            if (d->score_file)
+                score_file_insert(*d->score_file, {ref_hash, f.dist_hash[i], d->params_hash}, scores, 5);
+        }
 
+        VSFrame* dst;
         if (d->distmap) {
-            VSVideoFormat fmt;
-            if (!vsapi->queryVideoFormat(&fmt, cfGray, stFloat, 32, 0, 0, core)) {
-                vsapi->setFilterError("Butteraugli: Failed to create grayscale float format", frameCtx);
-                vsapi->freeFrame(src);
-                vsapi->freeFrame(src2);
-                return nullptr;
-            }
-            VSFrame* dst = vsapi->newVideoFrame(&fmt, width, height, nullptr, core);
+            dst = vsapi->newVideoFrame(&d->vi_out.format, width, height, nullptr, core);
             float* dstp = reinterpret_cast<float*>(vsapi->getWritePtr(dst, 0));
             const ptrdiff_t dst_stride = vsapi->getStride(dst, 0) / sizeof(float);
 
@@ -146,48 +484,66 @@ static const VSFrame* VS_CC butteraugliGetFrame(int n, int activationReason, voi
                 memcpy(dstp, diff_map.Row(y), width * sizeof(float));
                 dstp += dst_stride;
             }
-            VSMap* dstProps = vsapi->getFramePropertiesRW(dst);
-
-            vsapi->mapSetFloat(dstProps, "_BUTTERAUGLI_QNorm", norm_q, maReplace);
-            vsapi->mapSetFloat(dstProps, "_BUTTERAUGLI_3Norm", norm3, maReplace);
-            vsapi->mapSetFloat(dstProps, "_BUTTERAUGLI_INFNorm", norm_inf, maReplace);
-
-            vsapi->freeFrame(src);
-            vsapi->freeFrame(src2);
-            return dst;
         } else if (d->heatmap) {
-            VSFrame* dst = vsapi->newVideoFrame(vsapi->getVideoFrameFormat(src2), width, height, src2, core);
+            dst = vsapi->newVideoFrame(&d->vi_out.format, width, height, f.src2[0], core);
             d->hmap(dst, diff_map, width, height, vsapi);
-            VSMap* dstProps = vsapi->getFramePropertiesRW(dst);
+        } else {
+            dst = vsapi->copyFrame(f.src2[0], core);
+        }
 
-            vsapi->mapSetFloat(dstProps, "_BUTTERAUGLI_QNorm", norm_q, maReplace);
-            vsapi->mapSetFloat(dstProps, "_BUTTERAUGLI_3Norm", norm3, maReplace);
-            vsapi->mapSetFloat(dstProps, "_BUTTERAUGLI_INFNorm", norm_inf, maReplace);
+        VSMap* dstProps = vsapi->getFramePropertiesRW(dst);
 
-            vsapi->freeFrame(src);
-            vsapi->freeFrame(src2);
-            return dst;
-        } else {
-            VSFrame* dst = vsapi->copyFrame(src2, core);
-            VSMap* dstProps = vsapi->getFramePropertiesRW(dst);
+        for (int i = 0; i < num_dist; i++) {
+            if (!f.gated[i])
+                set_butteraugli_norms(dstProps, f.norms[i], (num_dist == 1) ? -1 : i, vsapi);
+        }
 
-            vsapi->mapSetFloat(dstProps, "_BUTTERAUGLI_QNorm", norm_q, maReplace);
-            vsapi->mapSetFloat(dstProps, "_BUTTERAUGLI_3Norm", norm3, maReplace);
-            vsapi->mapSetFloat(dstProps, "_BUTTERAUGLI_INFNorm", norm_inf, maReplace);
+        if (d->log) {
+            for (const ButteraugliNorms& norms : f.norms)
+                f.log_row.insert(f.log_row.end(), {norms.norm_q, norms.norm3, norms.norm_inf, norms.p95, norms.p99});
+            if (!metric_log_push(*d->log, n, f.log_row.data())) {
+                vsapi->setFilterError("Butteraugli: failed to write the log", frameCtx);
+                vsapi->freeFrame(dst);
+                free_frames();
+                return nullptr;
+            }
+        }
 
-            vsapi->freeFrame(src);
-            vsapi->freeFrame(src2);
-            return dst;
+        for (int i = 0; i < static_cast<int>(f.blocks.size()); i++)
+            set_block_props(dstProps, "_BUTTERAUGLI", (num_dist == 1) ? "" : "_" + std::to_string(i), f.blocks[i], vsapi);
+
+        if (d->memo || d->score_file)
+            vsapi->mapSetInt(dstProps, "_BUTTERAUGLI_Memoized", memoized, maReplace);
+
+        if (d->gate_psnr > 0.0) {
+            for (int i = 0; i < num_dist; i++) {
+                const std::string suffix = (num_dist == 1) ? "" : "_" + std::to_string(i);
+                vsapi->mapSetInt(dstProps, ("_BUTTERAUGLI_Gated" + suffix).c_str(), f.gated[i], maReplace);
+                if (!std::isnan(f.psnr[i]))
+                    vsapi->mapSetFloat(dstProps, ("_BUTTERAUGLI_PSNR" + suffix).c_str(), f.psnr[i], maReplace);
+            }
         }
+        free_frames();
+        vsapi->mapSetInt(dstProps, "_BUTTERAUGLI_Scored", 1, maReplace);
+        if (d->score_file)
+            set_score_file_props(dstProps, "_BUTTERAUGLI", *d->score_file, vsapi);
+        vsapi->mapSetInt(dstProps, "_BUTTERAUGLI_WorkspacePeak", static_cast<int64_t>(d->workspaces.high_water()), maReplace);
+        set_memory_props(dstProps, "_BUTTERAUGLI", d->memory, vsapi);
+        return dst;
     }
     return nullptr;
 }
 
+static void free_nodes(BUTTERAUGLIData* d, const VSAPI* vsapi) {
+    vsapi->freeNode(d->node);
+    for (auto node2 : d->node2)
+        vsapi->freeNode(node2);
+}
+
 static void VS_CC butteraugliFree(void* instanceData, VSCore* core, const VSAPI* vsapi) {
     auto d{reinterpret_cast<BUTTERAUGLIData*>(instanceData)};
 
-    vsapi->freeNode(d->node);
-    vsapi->freeNode(d->node2);
+    free_nodes(d, vsapi);
     delete d;
 }
 
@@ -195,18 +551,12 @@ void VS_CC butteraugliCreate(const VSMap* in, VSMap* out, void* userData, VSCore
     auto d{std::make_unique<BUTTERAUGLIData>()};
     int err{0};
 
-    VSNode* node = vsapi->mapGetNode(in, "reference", 0, nullptr);
-    VSNode* node2 = vsapi->mapGetNode(in, "distorted", 0, nullptr);
-
-    d->node = toRGBS(node, core, vsapi);
-    d->node2 = toRGBS(node2, core, vsapi);
-
-    if (!d->node || !d->node2) {
-        vsapi->mapSetError(out, "Butteraugli: Failed to convert input to RGBS");
-        if (d->node) vsapi->freeNode(d->node);
-        if (d->node2) vsapi->freeNode(d->node2);
+    std::string clips_error;
+    if (!read_metric_clips(in, d->node, d->node2, clips_error, core, vsapi)) {
+        vsapi->mapSetError(out, ("Butteraugli: " + clips_error).c_str());
         return;
     }
+    const int num_dist = static_cast<int>(d->node2.size());
     d->vi = vsapi->getVideoInfo(d->node);
 
     d->heatmap = !!vsapi->mapGetInt(in, "heatmap", 0, &err);
@@ -219,8 +569,13 @@ void VS_CC butteraugliCreate(const VSMap* in, VSMap* out, void* userData, VSCore
 
     if (d->heatmap && d->distmap) {
         vsapi->mapSetError(out, "Butteraugli: 'heatmap' and 'distmap' cannot both be enabled at the same time.");
-        vsapi->freeNode(d->node);
-        vsapi->freeNode(d->node2);
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    if ((d->heatmap || d->distmap) && num_dist > 1) {
+        vsapi->mapSetError(out, "Butteraugli: 'heatmap' and 'distmap' require a single distorted clip.");
+        free_nodes(d.get(), vsapi);
         return;
     }
 
@@ -239,8 +594,7 @@ void VS_CC butteraugliCreate(const VSMap* in, VSMap* out, void* userData, VSCore
 
     if (intensity_target <= 0.0f) {
         vsapi->mapSetError(out, "Butteraugli: intensity_target must be greater than 0.0.");
-        vsapi->freeNode(d->node);
-        vsapi->freeNode(d->node2);
+        free_nodes(d.get(), vsapi);
         return;
     }
 
@@ -250,61 +604,236 @@ void VS_CC butteraugliCreate(const VSMap* in, VSMap* out, void* userData, VSCore
 
     if (d->qnorm_val <= 0.0) {
         vsapi->mapSetError(out, "Butteraugli: qnorm must be greater than 0.0.");
-        vsapi->freeNode(d->node);
-        vsapi->freeNode(d->node2);
+        free_nodes(d.get(), vsapi);
         return;
     }
 
-    if (d->vi->format.colorFamily != cfRGB) {
-        vsapi->mapSetError(out, "Butteraugli: the clip must be in RGB format.");
-        vsapi->freeNode(d->node);
-        vsapi->freeNode(d->node2);
+    d->threads = vsapi->mapGetIntSaturated(in, "threads", 0, &err);
+    if (err)
+        d->threads = 1;
+
+    if (d->threads < 0) {
+        vsapi->mapSetError(out, "Butteraugli: threads must be 0 (all cores) or greater.");
+        free_nodes(d.get(), vsapi);
         return;
     }
 
-    int bits = d->vi->format.bitsPerSample;
-    if (bits != 8 && bits != 16 && bits != 32) {
-        vsapi->mapSetError(out, "Butteraugli: the clip bit depth must be 8, 16, or 32.");
-        vsapi->freeNode(d->node);
-        vsapi->freeNode(d->node2);
+    if (d->threads == 0)
+        d->threads = static_cast<int>(JxlThreadParallelRunnerDefaultNumWorkerThreads());
+
+    d->strip = vsapi->mapGetIntSaturated(in, "strip", 0, &err);
+    if (err)
+        d->strip = 0;
+
+    if (d->strip < 0 || (d->strip && d->strip < kMinStripRows)) {
+        vsapi->mapSetError(out, ("Butteraugli: strip must be 0 (disabled) or at least " + std::to_string(kMinStripRows) + ".").c_str());
+        free_nodes(d.get(), vsapi);
         return;
     }
 
-    if (!vsh::isSameVideoInfo(vsapi->getVideoInfo(d->node2), d->vi)) {
-        vsapi->mapSetError(out, "Butteraugli: both clips must have the same format and dimensions.");
-        vsapi->freeNode(d->node);
-        vsapi->freeNode(d->node2);
+    if (d->strip && d->threads > 1) {
+        vsapi->mapSetError(out, "Butteraugli: 'strip' and 'threads' cannot be combined.");
+        free_nodes(d.get(), vsapi);
         return;
     }
 
-    switch (d->vi->format.bytesPerSample) {
-        case 1:
-            d->fill = (d->linput) ? fill_image<uint8_t, true> : fill_image<uint8_t, false>;
-            d->hmap = heatmap<uint8_t, 255>;
-            break;
-        case 2:
-            d->fill = (d->linput) ? fill_image<uint16_t, true> : fill_image<uint16_t, false>;
-            d->hmap = heatmap<uint16_t, 65535>;
-            break;
-        case 4:
-            d->fill = (d->linput) ? fill_imageF<true> : fill_imageF<false>;
-            d->hmap = heatmapF;
-            break;
+    d->blocksize = vsapi->mapGetIntSaturated(in, "blocksize", 0, &err);
+    if (err)
+        d->blocksize = 0;
+
+    if (d->blocksize < 0) {
+        vsapi->mapSetError(out, "Butteraugli: blocksize must be 0 (disabled) or greater.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    std::string region_error;
+    if (!read_metric_region(in, d->vi, d->region, region_error, vsapi)) {
+        vsapi->mapSetError(out, ("Butteraugli: " + region_error).c_str());
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    int max_inflight = vsapi->mapGetIntSaturated(in, "max_inflight", 0, &err);
+    if (err) {
+        max_inflight = -1;  // derived from the frame size once downscale is known
+    } else if (max_inflight < 0) {
+        vsapi->mapSetError(out, "Butteraugli: max_inflight must be 0 (unlimited) or greater.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    d->downscale = vsapi->mapGetIntSaturated(in, "downscale", 0, &err);
+    if (err)
+        d->downscale = 1;
+
+    if (d->downscale != 1 && d->downscale != 2 && d->downscale != 4) {
+        vsapi->mapSetError(out, "Butteraugli: downscale must be 1, 2 or 4.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    if (d->downscale > 1 && (d->distmap || d->heatmap)) {
+        vsapi->mapSetError(out, "Butteraugli: 'downscale' cannot be combined with 'heatmap' or 'distmap'.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    if (d->region.width < d->downscale || d->region.height < d->downscale) {
+        vsapi->mapSetError(out, "Butteraugli: the clip is too small for this downscale.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    d->gate_psnr = vsapi->mapGetFloat(in, "gate_psnr", 0, &err);
+    if (err)
+        d->gate_psnr = 0.0;
+
+    if (d->gate_psnr < 0.0) {
+        vsapi->mapSetError(out, "Butteraugli: gate_psnr must be 0.0 (disabled) or greater.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    if (d->gate_psnr > 0.0 && (d->distmap || d->heatmap || d->blocksize)) {
+        vsapi->mapSetError(out, "Butteraugli: 'gate_psnr' cannot be combined with 'heatmap', 'distmap' or 'blocksize'.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    d->memo = !!vsapi->mapGetInt(in, "memo", 0, &err);
+
+    // Only the norms are cached.
+    if (d->distmap || d->heatmap || d->blocksize)
+        d->memo = false;
+
+    std::string selection_error;
+    if (!read_frame_selection(in, d->vi->numFrames, d->selection, selection_error, vsapi)) {
+        vsapi->mapSetError(out, ("Butteraugli: " + selection_error).c_str());
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    // Skipped frames pass the distorted clip through, which doesn't match the format of a map.
+    if (!d->selection.all() && (d->heatmap || d->distmap)) {
+        vsapi->mapSetError(out, "Butteraugli: 'step' and 'frames' cannot be combined with 'heatmap' or 'distmap'.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    if (d->vi->format.colorFamily != cfRGB && d->vi->format.colorFamily != cfYUV) {
+        vsapi->mapSetError(out, "Butteraugli: the clip must be in RGB or YUV format.");
+        free_nodes(d.get(), vsapi);
+        return;
     }
 
-    VSVideoInfo vi_out = *d->vi;
+    int bits = d->vi->format.bitsPerSample;
+    if ((d->vi->format.sampleType == stInteger && bits > 16) || (d->vi->format.sampleType == stFloat && bits != 32)) {
+        vsapi->mapSetError(out, "Butteraugli: the clip must be 8-16 bit integer or 32 bit float.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    d->fill = select_fill(&d->vi->format, d->linput, d->downscale);
+    d->sse_row = select_sse_row(d->vi->format.bytesPerSample);
+    d->workspaces.set_memory_manager(&d->memory.manager);
+
+    // Bands and strips give slightly different scores, they're part of the key as well.
+    const double params[] = {1.0, static_cast<double>(d->vi->format.colorFamily), static_cast<double>(d->vi->format.sampleType), static_cast<double>(d->vi->format.bitsPerSample), static_cast<double>(d->vi->format.subSamplingW), static_cast<double>(d->vi->format.subSamplingH), static_cast<double>(d->linput), d->ba_params.intensity_target, d->qnorm_val, static_cast<double>(d->threads), static_cast<double>(d->strip), static_cast<double>(d->downscale), static_cast<double>(d->region.left), static_cast<double>(d->region.top), static_cast<double>(d->region.width), static_cast<double>(d->region.height)};
+    d->params_hash = hash_values(params, static_cast<int>(std::size(params)));
+
+    const char* cache_path = vsapi->mapGetData(in, "cache_path", 0, &err);
+    if (!err && cache_path[0]) {
+        if ((d->distmap || d->heatmap || d->blocksize)) {
+            vsapi->mapSetError(out, "Butteraugli: 'cache_path' cannot be combined with 'heatmap', 'distmap' or 'blocksize'.");
+            free_nodes(d.get(), vsapi);
+            return;
+        }
+
+        std::string cache_error;
+        d->score_file = open_score_file(cache_path, cache_error);
+        if (!d->score_file) {
+            vsapi->mapSetError(out, ("Butteraugli: " + cache_error).c_str());
+            free_nodes(d.get(), vsapi);
+            return;
+        }
+    }
+
+    const char* log_path = vsapi->mapGetData(in, "log", 0, &err);
+    if (!err && log_path[0]) {
+        std::vector<std::string> columns;
+        for (int i = 0; i < num_dist; i++) {
+            const std::string suffix = (num_dist == 1) ? "" : "_" + std::to_string(i);
+            for (const char* name : {"_BUTTERAUGLI_QNorm", "_BUTTERAUGLI_3Norm", "_BUTTERAUGLI_INFNorm", "_BUTTERAUGLI_P95", "_BUTTERAUGLI_P99"})
+                columns.push_back(name + suffix);
+        }
+
+        std::string log_error;
+        d->log = open_metric_log(log_path, columns, d->selection, d->vi->numFrames, log_error);
+        if (!d->log) {
+            vsapi->mapSetError(out, ("Butteraugli: " + log_error).c_str());
+            free_nodes(d.get(), vsapi);
+            return;
+        }
+    }
+
+    // YUV and high bit depth input can't be used as is for the heatmap, it's written as 8/16 bit or float RGB.
+    d->vi_out = *vsapi->getVideoInfo(d->node2[0]);
+    if (d->distmap || d->heatmap) {
+        d->vi_out.width = d->region.width;
+        d->vi_out.height = d->region.height;
+    }
     if (d->distmap) {
-        VSVideoFormat fmt;
-        if (!vsapi->queryVideoFormat(&fmt, cfGray, stFloat, 32, 0, 0, core)) {
+        if (!vsapi->queryVideoFormat(&d->vi_out.format, cfGray, stFloat, 32, 0, 0, core)) {
             vsapi->mapSetError(out, "Butteraugli: Failed to create grayscale float format");
-            vsapi->freeNode(d->node);
-            vsapi->freeNode(d->node2);
+            free_nodes(d.get(), vsapi);
             return;
         }
-        vi_out.format = fmt;
+    } else if (d->heatmap) {
+        if (d->vi->format.sampleType == stFloat) {
+            vsapi->queryVideoFormat(&d->vi_out.format, cfRGB, stFloat, 32, 0, 0, core);
+            d->hmap = heatmapF;
+        } else if (bits == 8) {
+            vsapi->queryVideoFormat(&d->vi_out.format, cfRGB, stInteger, 8, 0, 0, core);
+            d->hmap = heatmap<uint8_t, 255>;
+        } else {
+            vsapi->queryVideoFormat(&d->vi_out.format, cfRGB, stInteger, 16, 0, 0, core);
+            d->hmap = heatmap<uint16_t, 65535>;
+        }
+    }
+
+    if (d->threads > 1) {
+        // The first runner is created here, so a failure shows up as an error of the call.
+        d->runners.set_threads(d->threads);
+        void* runner = d->runners.acquire();
+        if (!runner) {
+            vsapi->mapSetError(out, "Butteraugli: Failed to create the thread pool");
+            free_nodes(d.get(), vsapi);
+            return;
+        }
+        d->runners.release(runner);
+    }
+
+    if (max_inflight < 0) {
+        // The strip mode only holds strip sized images.
+        const int width = d->region.width / d->downscale;
+        const int height = d->region.height / d->downscale;
+        max_inflight = default_max_inflight(width, d->strip ? std::min(height, d->strip + 2 * kBandOverlap) : height, core, vsapi);
+    }
+
+    std::vector<VSFilterDependency> deps{{d->node, rpGeneral}};
+    for (auto node2 : d->node2)
+        deps.push_back({node2, rpGeneral});
+
+    if (max_inflight > 0) {
+        const VSVideoInfo vi = d->vi_out;
+        std::shared_ptr<void> data(d.release(), [vsapi](void* p) { butteraugliFree(p, nullptr, vsapi); });
+        std::string lanes_error;
+        if (!create_metric_lanes(out, "Butteraugli", &vi, butteraugliGetFrame, std::move(data), max_inflight, deps, lanes_error, core, vsapi))
+            vsapi->mapSetError(out, ("Butteraugli: " + lanes_error).c_str());
+        return;
     }
 
-    VSFilterDependency deps[]{{d->node, rpGeneral}, {d->node2, rpGeneral}};
-    vsapi->createVideoFilter(out, "Butteraugli", &vi_out, butteraugliGetFrame, butteraugliFree, fmParallel, deps, 2, d.get(), core);
+    vsapi->createVideoFilter(out, "Butteraugli", &d->vi_out, butteraugliGetFrame, butteraugliFree, fmParallel, deps.data(), static_cast<int>(deps.size()), d.get(), core);
     d.release();
 }
\ No newline at end of file
@@ -0,0 +1,367 @@
+#include <thread>
+#include <unordered_map>
+
+#include "shared.h"
+
+// Clip-level summary of per-frame metric props, written to a JSON file when the filter is freed and, with running=1,
+// attached to every frame as _SUMMARY* props covering the frames seen so far. Every worker thread adds its frames to
+// its own accumulator, found through a thread_local cache, and the accumulators are only merged for the file and for
+// frames that carry the running summary. Quantiles come from a KLL sketch: level h holds items of weight 2^h and a full level is
+// sorted and every other item is promoted, so memory stays at a few hundred values per prop however long the
+// clip is.
+
+constexpr size_t kSketchK = 200;
+constexpr size_t kSketchMinCapacity = 8;
+
+class QuantileSketch final {
+   public:
+    void add(double v) {
+        if (levels.empty())
+            levels.resize(1);
+        levels[0].push_back(v);
+        compress();
+    }
+
+    void merge(const QuantileSketch& other) {
+        if (other.levels.size() > levels.size())
+            levels.resize(other.levels.size());
+        for (size_t h{0}; h < other.levels.size(); h++) {
+            levels[h].insert(levels[h].end(), other.levels[h].begin(), other.levels[h].end());
+        }
+        compress();
+    }
+
+    // Values for several quantiles from one sorted pass, q must be ascending.
+    void quantiles(const double* q, double* out, int count) const {
+        std::vector<std::pair<double, uint64_t>> items;
+        uint64_t total = 0;
+        for (size_t h{0}; h < levels.size(); h++) {
+            for (const double v : levels[h]) {
+                items.emplace_back(v, uint64_t(1) << h);
+            }
+            total += levels[h].size() << h;
+        }
+
+        if (items.empty()) {
+            std::fill_n(out, count, std::numeric_limits<double>::quiet_NaN());
+            return;
+        }
+
+        std::sort(items.begin(), items.end());
+        uint64_t cumulative = 0;
+        size_t i = 0;
+        for (int j{0}; j < count; j++) {
+            const double target = q[j] * static_cast<double>(total);
+            while (i + 1 < items.size() && static_cast<double>(cumulative + items[i].second) < target) {
+                cumulative += items[i].second;
+                i++;
+            }
+            out[j] = items[i].first;
+        }
+    }
+
+   private:
+    size_t capacity(size_t h) const noexcept {
+        const double scale = std::pow(2.0 / 3.0, static_cast<double>(levels.size() - 1 - h));
+        return std::max(kSketchMinCapacity, static_cast<size_t>(kSketchK * scale));
+    }
+
+    void compress() {
+        for (size_t h{0}; h < levels.size(); h++) {
+            if (levels[h].size() < capacity(h))
+                continue;
+            if (h + 1 == levels.size())
+                levels.emplace_back();
+
+            std::vector<double>& level = levels[h];
+            std::sort(level.begin(), level.end());
+
+            // An odd item stays behind so the total weight is kept exactly.
+            const size_t pairs = level.size() / 2;
+            const size_t offset = (odd = !odd) ? 1 : 0;
+            for (size_t i{0}; i < pairs; i++) {
+                levels[h + 1].push_back(level[2 * i + offset]);
+            }
+
+            if (level.size() % 2)
+                level.front() = level.back();
+            level.resize(level.size() % 2);
+        }
+    }
+
+    std::vector<std::vector<double>> levels;
+    bool odd = false;
+};
+
+struct PropSummary final {
+    uint64_t count = 0;
+    double sum = 0.0;
+    double inv_sum = 0.0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    bool nonpositive = false;
+    QuantileSketch sketch;
+
+    void add(double v) {
+        count++;
+        sum += v;
+        if (v > 0.0)
+            inv_sum += 1.0 / v;
+        else
+            nonpositive = true;
+        min = std::min(min, v);
+        max = std::max(max, v);
+        sketch.add(v);
+    }
+
+    void merge(const PropSummary& other) {
+        count += other.count;
+        sum += other.sum;
+        inv_sum += other.inv_sum;
+        nonpositive |= other.nonpositive;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        sketch.merge(other.sketch);
+    }
+};
+
+constexpr int kSummaryQuantiles = 5;
+constexpr double kQuantiles[kSummaryQuantiles]{0.05, 0.25, 0.5, 0.75, 0.95};
+constexpr const char* kQuantileNames[kSummaryQuantiles]{"P5", "P25", "P50", "P75", "P95"};
+constexpr const char* kQuantileKeys[kSummaryQuantiles]{"p5", "p25", "p50", "p75", "p95"};
+
+struct SummaryValues final {
+    int64_t count;
+    double mean;
+    double harmonic_mean;  // NaN once a value <= 0 was seen
+    double min;
+    double max;
+    double quantiles[kSummaryQuantiles];
+};
+
+static SummaryValues summarize(const PropSummary& s) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    SummaryValues v;
+    v.count = static_cast<int64_t>(s.count);
+    v.mean = s.count ? s.sum / s.count : nan;
+    v.harmonic_mean = (s.count && !s.nonpositive) ? s.count / s.inv_sum : nan;
+    v.min = s.count ? s.min : nan;
+    v.max = s.count ? s.max : nan;
+    s.sketch.quantiles(kQuantiles, v.quantiles, kSummaryQuantiles);
+    return v;
+}
+
+// Only the owning thread adds to an accumulator. The mutex is uncontended unless a running summary is being merged.
+struct ThreadAccumulator final {
+    std::mutex mutex;
+    std::vector<PropSummary> props;
+};
+
+struct MetricSummaryData final {
+    VSNode* node;
+    uint64_t id;  // tells instances apart in the thread_local cache, addresses can be reused
+    std::vector<std::string> props;
+    std::vector<std::string> prefixes;
+    bool running;
+    std::mutex registry_mutex;
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadAccumulator>> accumulators;
+    std::vector<std::atomic<bool>> seen;
+    std::atomic<int> frames{0};
+    FILE* json;
+};
+
+static ThreadAccumulator& thread_accumulator(MetricSummaryData* d) {
+    thread_local uint64_t cached_id = 0;
+    thread_local ThreadAccumulator* cached = nullptr;
+    if (cached_id == d->id)
+        return *cached;
+
+    std::lock_guard<std::mutex> lock(d->registry_mutex);
+    auto& acc = d->accumulators[std::this_thread::get_id()];
+    if (!acc) {
+        acc = std::make_unique<ThreadAccumulator>();
+        acc->props.resize(d->props.size());
+    }
+    cached_id = d->id;
+    cached = acc.get();
+    return *acc;
+}
+
+static std::vector<PropSummary> merge_accumulators(MetricSummaryData* d) {
+    std::vector<PropSummary> merged(d->props.size());
+    std::lock_guard<std::mutex> lock(d->registry_mutex);
+    for (const auto& [thread, acc] : d->accumulators) {
+        std::lock_guard<std::mutex> acc_lock(acc->mutex);
+        for (size_t p{0}; p < d->props.size(); p++) {
+            merged[p].merge(acc->props[p]);
+        }
+    }
+    return merged;
+}
+
+static void json_number(FILE* f, double v) {
+    if (std::isfinite(v))
+        fprintf(f, "%.17g", v);
+    else
+        fputs("null", f);
+}
+
+static void json_string(FILE* f, const std::string& s) {
+    fputc('"', f);
+    for (const char c : s) {
+        if (c == '"' || c == '\\')
+            fputc('\\', f);
+        if (static_cast<unsigned char>(c) < 0x20)
+            fprintf(f, "\\u%04x", c);
+        else
+            fputc(c, f);
+    }
+    fputc('"', f);
+}
+
+static void write_summary(MetricSummaryData* d) {
+    const std::vector<PropSummary> merged = merge_accumulators(d);
+    FILE* f = d->json;
+
+    fprintf(f, "{\n  \"frames\": %d,\n  \"props\": {", d->frames.load());
+    for (size_t p{0}; p < d->props.size(); p++) {
+        const SummaryValues v = summarize(merged[p]);
+        fputs(p ? ",\n    " : "\n    ", f);
+        json_string(f, d->props[p]);
+        fprintf(f, ": {\"count\": %lld, \"mean\": ", static_cast<long long>(v.count));
+        json_number(f, v.mean);
+        fputs(", \"harmonic_mean\": ", f);
+        json_number(f, v.harmonic_mean);
+        fputs(", \"min\": ", f);
+        json_number(f, v.min);
+        fputs(", \"max\": ", f);
+        json_number(f, v.max);
+        for (int q{0}; q < kSummaryQuantiles; q++) {
+            fprintf(f, ", \"%s\": ", kQuantileKeys[q]);
+            json_number(f, v.quantiles[q]);
+        }
+        fputc('}', f);
+    }
+    fputs("\n  }\n}\n", f);
+}
+
+static const VSFrame* VS_CC metricsummaryGetFrame(int n, int activationReason, void* instanceData, void** frameData, VSFrameContext* frameCtx, VSCore* core, const VSAPI* vsapi) {
+    auto d{reinterpret_cast<MetricSummaryData*>(instanceData)};
+
+    if (activationReason == arInitial) {
+        vsapi->requestFrameFilter(n, d->node, frameCtx);
+    } else if (activationReason == arAllFramesReady) {
+        const VSFrame* src = vsapi->getFrameFilter(n, d->node, frameCtx);
+        const VSMap* src_props = vsapi->getFramePropertiesRO(src);
+
+        // A frame requested twice (cache misses, seeking back) is only counted once.
+        if (!d->seen[n].exchange(true)) {
+            ThreadAccumulator& acc = thread_accumulator(d);
+            std::lock_guard<std::mutex> lock(acc.mutex);
+            for (size_t p{0}; p < d->props.size(); p++) {
+                const char* key = d->props[p].c_str();
+                int err{0};
+                const int type = vsapi->mapGetType(src_props, key);
+                double v;
+                if (type == ptFloat)
+                    v = vsapi->mapGetFloat(src_props, key, 0, &err);
+                else if (type == ptInt)
+                    v = static_cast<double>(vsapi->mapGetInt(src_props, key, 0, &err));
+                else
+                    continue;
+                if (!err && !std::isnan(v))
+                    acc.props[p].add(v);
+            }
+            d->frames++;
+        }
+
+        if (!d->running)
+            return src;
+
+        // The running summary covers the frames seen so far, _SUMMARY_Frames tells how complete it is.
+        const std::vector<PropSummary> merged = merge_accumulators(d);
+        VSFrame* dst = vsapi->copyFrame(src, core);
+        vsapi->freeFrame(src);
+        VSMap* props = vsapi->getFramePropertiesRW(dst);
+
+        vsapi->mapSetInt(props, "_SUMMARY_Frames", d->frames.load(), maReplace);
+        for (size_t p{0}; p < d->props.size(); p++) {
+            const SummaryValues v = summarize(merged[p]);
+            const std::string& prefix = d->prefixes[p];
+            vsapi->mapSetInt(props, (prefix + "_Count").c_str(), v.count, maReplace);
+            if (!v.count)
+                continue;
+            vsapi->mapSetFloat(props, (prefix + "_Mean").c_str(), v.mean, maReplace);
+            if (!std::isnan(v.harmonic_mean))
+                vsapi->mapSetFloat(props, (prefix + "_HarmonicMean").c_str(), v.harmonic_mean, maReplace);
+            vsapi->mapSetFloat(props, (prefix + "_Min").c_str(), v.min, maReplace);
+            vsapi->mapSetFloat(props, (prefix + "_Max").c_str(), v.max, maReplace);
+            for (int q{0}; q < kSummaryQuantiles; q++) {
+                vsapi->mapSetFloat(props, (prefix + "_" + kQuantileNames[q]).c_str(), v.quantiles[q], maReplace);
+            }
+        }
+
+        return dst;
+    }
+    return nullptr;
+}
+
+static void VS_CC metricsummaryFree(void* instanceData, VSCore* core, const VSAPI* vsapi) {
+    auto d{reinterpret_cast<MetricSummaryData*>(instanceData)};
+
+    if (d->json) {
+        write_summary(d);
+        fclose(d->json);
+    }
+
+    vsapi->freeNode(d->node);
+    delete d;
+}
+
+void VS_CC metricsummaryCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi) {
+    auto d{std::make_unique<MetricSummaryData>()};
+    int err{0};
+
+    const int num_props = vsapi->mapNumElements(in, "props");
+    for (int i{0}; i < num_props; i++) {
+        const std::string prop = vsapi->mapGetData(in, "props", i, nullptr);
+        if (prop.empty()) {
+            vsapi->mapSetError(out, "MetricSummary: prop names can't be empty.");
+            return;
+        }
+        d->props.push_back(prop);
+        d->prefixes.push_back(prop[0] == '_' ? "_SUMMARY" + prop : "_SUMMARY_" + prop);
+    }
+
+    d->running = !!vsapi->mapGetInt(in, "running", 0, &err);
+    if (err)
+        d->running = false;
+
+    d->json = nullptr;
+    const char* path = vsapi->mapGetData(in, "path", 0, &err);
+    if (!err) {
+        if (!path[0]) {
+            vsapi->mapSetError(out, "MetricSummary: path can't be empty.");
+            return;
+        }
+        d->json = fopen(path, "w");
+        if (!d->json) {
+            vsapi->mapSetError(out, ("MetricSummary: can't open " + std::string(path) + " for writing.").c_str());
+            return;
+        }
+    } else if (!d->running) {
+        vsapi->mapSetError(out, "MetricSummary: set path, running=1 or both.");
+        return;
+    }
+
+    d->node = vsapi->mapGetNode(in, "clip", 0, nullptr);
+    const VSVideoInfo* vi = vsapi->getVideoInfo(d->node);
+
+    static std::atomic<uint64_t> next_id{1};
+    d->id = next_id++;
+    d->seen = std::vector<std::atomic<bool>>(vi->numFrames);
+
+    VSFilterDependency deps[]{{d->node, rpStrictSpatial}};
+    vsapi->createVideoFilter(out, "MetricSummary", vi, metricsummaryGetFrame, metricsummaryFree, fmParallel, deps, 1, d.get(), core);
+    d.release();
+}
\ No newline at end of file
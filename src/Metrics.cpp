@@ -0,0 +1,263 @@
+#include "shared.h"
+
+struct METRICSData final {
+    VSNode* node;
+    VSNode* node2;
+    const VSVideoInfo* vi;
+    jxl::ButteraugliParams ba_params;
+    double qnorm_val;
+    bool linput;
+    bool simple;
+    bool butteraugli;
+    bool ssimulacra2;
+    bool ssimulacra;
+    bool zero_copy;
+    MemoryStats memory;  // declared before workspaces, it must outlive them
+    WorkspacePool workspaces;
+
+    FillFunc fill;
+};
+
+static const VSFrame* VS_CC metricsGetFrame(int n, int activationReason, void* instanceData, void** frameData, VSFrameContext* frameCtx, VSCore* core, const VSAPI* vsapi) {
+    auto d{static_cast<METRICSData*>(instanceData)};
+
+    if (activationReason == arInitial) {
+        vsapi->requestFrameFilter(n, d->node, frameCtx);
+        vsapi->requestFrameFilter(n, d->node2, frameCtx);
+    } else if (activationReason == arAllFramesReady) {
+        MemoryBudgetGuard budget(d->memory);
+
+        const VSFrame* src = vsapi->getFrameFilter(n, d->node, frameCtx);
+        const VSFrame* src2 = vsapi->getFrameFilter(n, d->node2, frameCtx);
+
+        int width = vsapi->getFrameWidth(src2, 0);
+        int height = vsapi->getFrameHeight(src2, 0);
+
+        MetricWorkspace* ws = d->workspaces.acquire(d->zero_copy ? 0 : width, d->zero_copy ? 0 : height);
+
+        auto free_frames = [&]() {
+            vsapi->freeFrame(src);
+            vsapi->freeFrame(src2);
+            if (ws)
+                d->workspaces.release(ws);
+        };
+
+        if (!ws) {
+            vsapi->setFilterError("Metrics: Failed to allocate image", frameCtx);
+            free_frames();
+            return nullptr;
+        }
+
+        if (d->zero_copy) {
+            if (!ssimulacra2_reference(frame_view(src, vsapi), ws->ref_pyramid, ws->scratch)) {
+                vsapi->setFilterError("Metrics: Failed to build the SSIMULACRA2 reference", frameCtx);
+                free_frames();
+                return nullptr;
+            }
+
+            auto result = ssimulacra2_compare(ws->ref_pyramid, frame_view(src2, vsapi), ws->scratch);
+            if (!result.ok()) {
+                vsapi->setFilterError("Metrics: ComputeSSIMULACRA2 failed", frameCtx);
+                free_frames();
+                return nullptr;
+            }
+
+            VSFrame* dst = vsapi->copyFrame(src2, core);
+            VSMap* dstProps = vsapi->getFramePropertiesRW(dst);
+            Msssim msssim = std::move(result).value_();
+            vsapi->mapSetFloat(dstProps, "_SSIMULACRA2", msssim.Score(), maReplace);
+            free_frames();
+            vsapi->mapSetInt(dstProps, "_METRICS_WorkspacePeak", static_cast<int64_t>(d->workspaces.high_water()), maReplace);
+            set_memory_props(dstProps, "_METRICS", d->memory, vsapi);
+            return dst;
+        }
+
+        jxl::Image3F& ref_linear = ws->ref;
+        jxl::Image3F& dist_linear = ws->dist;
+
+        // Every metric works on linear light, so the pair is converted once and all of them read the same buffers.
+        if (!d->fill(ref_linear, src, 0, 0, width, height, ws->fill, vsapi) || !d->fill(dist_linear, src2, 0, 0, width, height, ws->fill, vsapi)) {
+            vsapi->setFilterError((std::string("Metrics: ") + ws->fill.error).c_str(), frameCtx);
+            free_frames();
+            return nullptr;
+        }
+
+        VSFrame* dst = vsapi->copyFrame(src2, core);
+        VSMap* dstProps = vsapi->getFramePropertiesRW(dst);
+
+        if (d->butteraugli) {
+            double score;
+            if (!jxl::ButteraugliInterface(ref_linear, dist_linear, d->ba_params, ws->diff_map, score)) {
+                vsapi->setFilterError("Metrics: ButteraugliInterface failed", frameCtx);
+                vsapi->freeFrame(dst);
+                free_frames();
+                return nullptr;
+            }
+
+            set_butteraugli_norms(dstProps, compute_norms(ws->diff_map, d->qnorm_val), -1, vsapi);
+        }
+
+        if (d->ssimulacra2) {
+            if (!ssimulacra2_reference(image_view(ref_linear), ws->ref_pyramid, ws->scratch)) {
+                vsapi->setFilterError("Metrics: Failed to build the SSIMULACRA2 reference", frameCtx);
+                vsapi->freeFrame(dst);
+                free_frames();
+                return nullptr;
+            }
+
+            auto result = ssimulacra2_compare(ws->ref_pyramid, image_view(dist_linear), ws->scratch);
+            if (result.ok()) {
+                Msssim msssim = std::move(result).value_();
+                vsapi->mapSetFloat(dstProps, "_SSIMULACRA2", msssim.Score(), maReplace);
+            } else {
+                vsapi->setFilterError("Metrics: ComputeSSIMULACRA2 failed", frameCtx);
+                vsapi->freeFrame(dst);
+                free_frames();
+                return nullptr;
+            }
+        }
+
+        if (d->ssimulacra) {
+            auto result = ssimulacra::ComputeDiff(ref_linear, dist_linear, d->simple);
+            if (result.ok()) {
+                ssimulacra::Ssimulacra ssimulacra_ = std::move(result).value_();
+                vsapi->mapSetFloat(dstProps, "_SSIMULACRA", ssimulacra_.Score(), maReplace);
+            } else {
+                vsapi->setFilterError("Metrics: ssimulacra::ComputeDiff failed", frameCtx);
+                vsapi->freeFrame(dst);
+                free_frames();
+                return nullptr;
+            }
+        }
+
+        free_frames();
+        vsapi->mapSetInt(dstProps, "_METRICS_WorkspacePeak", static_cast<int64_t>(d->workspaces.high_water()), maReplace);
+        set_memory_props(dstProps, "_METRICS", d->memory, vsapi);
+        return dst;
+    }
+    return nullptr;
+}
+
+static void VS_CC metricsFree(void* instanceData, VSCore* core, const VSAPI* vsapi) {
+    auto d{reinterpret_cast<METRICSData*>(instanceData)};
+
+    vsapi->freeNode(d->node);
+    vsapi->freeNode(d->node2);
+    delete d;
+}
+
+void VS_CC metricsCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi) {
+    auto d{std::make_unique<METRICSData>()};
+    int err{0};
+
+    VSNode* node = vsapi->mapGetNode(in, "reference", 0, nullptr);
+    VSNode* node2 = vsapi->mapGetNode(in, "distorted", 0, nullptr);
+
+    d->node = toMetricInput(node, core, vsapi);
+    d->node2 = toMetricInput(node2, core, vsapi);
+
+    if (!d->node || !d->node2) {
+        vsapi->mapSetError(out, "Metrics: Failed to convert input");
+        if (d->node) vsapi->freeNode(d->node);
+        if (d->node2) vsapi->freeNode(d->node2);
+        return;
+    }
+    d->vi = vsapi->getVideoInfo(d->node);
+
+    const int num_metrics = vsapi->mapNumElements(in, "metrics");
+    if (num_metrics <= 0) {
+        d->butteraugli = true;
+        d->ssimulacra2 = true;
+        d->ssimulacra = true;
+    } else {
+        for (int i = 0; i < num_metrics; i++) {
+            const std::string metric = vsapi->mapGetData(in, "metrics", i, nullptr);
+
+            if (metric == "butteraugli") {
+                d->butteraugli = true;
+            } else if (metric == "ssimulacra2") {
+                d->ssimulacra2 = true;
+            } else if (metric == "ssimulacra") {
+                d->ssimulacra = true;
+            } else {
+                vsapi->mapSetError(out, ("Metrics: unknown metric \"" + metric + "\", expected butteraugli, ssimulacra2 or ssimulacra.").c_str());
+                vsapi->freeNode(d->node);
+                vsapi->freeNode(d->node2);
+                return;
+            }
+        }
+    }
+
+    d->linput = !!vsapi->mapGetInt(in, "linput", 0, &err);
+    if (err)
+        d->linput = false;
+
+    d->simple = !!vsapi->mapGetInt(in, "simple", 0, &err);
+    if (err)
+        d->simple = false;
+
+    float intensity_target;
+    intensity_target = vsapi->mapGetFloatSaturated(in, "intensity_target", 0, &err);
+    if (err)
+        intensity_target = 203.0f;
+
+    d->ba_params.hf_asymmetry = 0.8f;
+    d->ba_params.xmul = 1.0f;
+    d->ba_params.intensity_target = intensity_target;
+
+    if (intensity_target <= 0.0f) {
+        vsapi->mapSetError(out, "Metrics: intensity_target must be greater than 0.0.");
+        vsapi->freeNode(d->node);
+        vsapi->freeNode(d->node2);
+        return;
+    }
+
+    d->qnorm_val = vsapi->mapGetFloatSaturated(in, "qnorm", 0, &err);
+    if (err)
+        d->qnorm_val = 2.0;
+
+    if (d->qnorm_val <= 0.0) {
+        vsapi->mapSetError(out, "Metrics: qnorm must be greater than 0.0.");
+        vsapi->freeNode(d->node);
+        vsapi->freeNode(d->node2);
+        return;
+    }
+
+    if (d->vi->format.colorFamily != cfRGB && d->vi->format.colorFamily != cfYUV) {
+        vsapi->mapSetError(out, "Metrics: the clip must be in RGB or YUV format.");
+        vsapi->freeNode(d->node);
+        vsapi->freeNode(d->node2);
+        return;
+    }
+
+    int bits = d->vi->format.bitsPerSample;
+    if ((d->vi->format.sampleType == stInteger && bits > 16) || (d->vi->format.sampleType == stFloat && bits != 32)) {
+        vsapi->mapSetError(out, "Metrics: the clip must be 8-16 bit integer or 32 bit float.");
+        vsapi->freeNode(d->node);
+        vsapi->freeNode(d->node2);
+        return;
+    }
+
+    if (!vsh::isSameVideoInfo(vsapi->getVideoInfo(d->node2), d->vi)) {
+        vsapi->mapSetError(out, "Metrics: both clips must have the same format and dimensions.");
+        vsapi->freeNode(d->node);
+        vsapi->freeNode(d->node2);
+        return;
+    }
+
+    if ((d->ssimulacra2 || d->ssimulacra) && (d->vi->height < 8 || d->vi->width < 8)) {
+        vsapi->mapSetError(out, "Metrics: minimum image size for SSIMULACRA is 8x8 pixels.");
+        vsapi->freeNode(d->node);
+        vsapi->freeNode(d->node2);
+        return;
+    }
+
+    d->fill = select_fill(&d->vi->format, d->linput);
+    d->workspaces.set_memory_manager(&d->memory.manager);
+    // Butteraugli and SSIMULACRA need jxl::Image3F buffers; SSIMULACRA2 alone can read linear RGBS frames in place.
+    d->zero_copy = d->linput && !d->butteraugli && !d->ssimulacra && d->vi->format.colorFamily == cfRGB && d->vi->format.sampleType == stFloat;
+
+    VSFilterDependency deps[]{{d->node, rpGeneral}, {d->node2, rpGeneral}};
+    vsapi->createVideoFilter(out, "Metrics", d->vi, metricsGetFrame, metricsFree, fmParallel, deps, 2, d.get(), core);
+    d.release();
+}
\ No newline at end of file
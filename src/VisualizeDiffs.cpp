@@ -7,13 +7,9 @@ struct VISUALIZEDIFFSData final {
     VSNode* node2;
     bool auto_gain;
     int type;
-    void (*autogain_process)(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+    AutoGainFunc autogain_process;
 };
 
-extern void colormap_process(const uint8_t* srcp, VSFrame* dst, const ptrdiff_t stride, const int w, const int h, int type, const VSAPI* vsapi) noexcept;
-extern void autogainUC_c(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
-extern void autogainUC_avx2(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
-
 static const VSFrame* VS_CC visualizediffsGetFrame(int n, int activationReason, void* instanceData, void** frameData, VSFrameContext* frameCtx, VSCore* core, const VSAPI* vsapi) {
     auto d{static_cast<VISUALIZEDIFFSData*>(instanceData)};
 
@@ -57,11 +53,12 @@ static const VSFrame* VS_CC visualizediffsGetFrame(int n, int activationReason,
             tmpp2 -= stride * height;
         }
 
+        uint8_t* const dstp[3] = {vsapi->getWritePtr(dst, 0), vsapi->getWritePtr(dst, 1), vsapi->getWritePtr(dst, 2)};
         if (d->auto_gain) {
             d->autogain_process(tmpp2, tmpp, stride, width, height);
-            colormap_process(tmpp, dst, stride, width, height, d->type, vsapi);
+            colormap_process(tmpp, stride, dstp, stride, width, height, d->type);
         } else {
-            colormap_process(tmpp2, dst, stride, width, height, d->type, vsapi);
+            colormap_process(tmpp2, stride, dstp, stride, width, height, d->type);
         }
 
         vsapi->freeFrame(src1);
@@ -133,11 +130,7 @@ void VS_CC visualizediffsCreate(const VSMap* in, VSMap* out, void* userData, VSC
         vsapi->freeMap(args);
     }
 
-#ifdef PLUGIN_X86
-    d->autogain_process = (instrset_detect() >= 8) ? autogainUC_avx2 : autogainUC_c;
-#else
-    d->autogain_process = autogainUC_c;
-#endif
+    d->autogain_process = select_autogain(8);
 
     VSFilterDependency deps[]{{d->node1, rpGeneral}, {d->node2, rpGeneral}};
     vsapi->createVideoFilter(out, "VisualizeDiffs", &d->vi_out, visualizediffsGetFrame, visualizediffsFree, fmParallel, deps, 2, d.get(), core);
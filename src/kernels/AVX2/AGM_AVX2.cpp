@@ -1,5 +1,5 @@
 #ifdef PLUGIN_X86
-#include "../shared.h"
+#include "../kernels.h"
 
 FORCE_INLINE void get_mask_avx2_8(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, const ptrdiff_t stride, const float frange[], const int width, const int height, const float scaling) {
     uint8_t lut[256];
@@ -49,27 +49,21 @@ FORCE_INLINE void get_mask_avx2_f(const float* VS_RESTRICT srcp, float* VS_RESTR
 }
 
 template <typename pixel_t>
-void agm_process_avx2(const VSFrame* src, VSFrame* dst, float& avg, const AGMData* const VS_RESTRICT d, const VSAPI* vsapi) noexcept {
-    for (int plane{0}; plane < d->vi->format.numPlanes; plane++) {
-        const auto width{vsapi->getFrameWidth(src, plane)};
-        const auto height{vsapi->getFrameHeight(src, plane)};
-        const auto stride{vsapi->getStride(src, plane) / d->vi->format.bytesPerSample};
+void agm_process_avx2(const uint8_t* VS_RESTRICT srcp8, uint8_t* VS_RESTRICT dstp8, ptrdiff_t stride, int width, int height, float scaling, int bits) noexcept {
+    auto srcp{reinterpret_cast<const pixel_t*>(srcp8)};
+    auto dstp{reinterpret_cast<pixel_t*>(dstp8)};
+    stride /= sizeof(pixel_t);
 
-        auto srcp{reinterpret_cast<const pixel_t*>(vsapi->getReadPtr(src, plane))};
-        auto dstp{reinterpret_cast<pixel_t*>(vsapi->getWritePtr(dst, plane))};
-        const float scaling{avg * avg * d->luma_scaling};
-
-        if constexpr (std::is_same_v<pixel_t, uint8_t>) {
-            get_mask_avx2_8(srcp, dstp, stride, d->float_range, width, height, scaling);
-        } else if constexpr (std::is_same_v<pixel_t, uint16_t>) {
-            get_mask_avx2_16(srcp, dstp, stride, d->float_range, width, height, scaling, d->peak, d->shift);
-        } else {
-            get_mask_avx2_f(srcp, dstp, stride, width, height, scaling);
-        }
+    if constexpr (std::is_same_v<pixel_t, uint8_t>) {
+        get_mask_avx2_8(srcp, dstp, stride, agm_curve(), width, height, scaling);
+    } else if constexpr (std::is_same_v<pixel_t, uint16_t>) {
+        get_mask_avx2_16(srcp, dstp, stride, agm_curve(), width, height, scaling, (1 << bits) - 1, bits - 8);
+    } else {
+        get_mask_avx2_f(srcp, dstp, stride, width, height, scaling);
     }
 }
 
-template void agm_process_avx2<uint8_t>(const VSFrame* src, VSFrame* dst, float& avg, const AGMData* const VS_RESTRICT d, const VSAPI* vsapi) noexcept;
-template void agm_process_avx2<uint16_t>(const VSFrame* src, VSFrame* dst, float& avg, const AGMData* const VS_RESTRICT d, const VSAPI* vsapi) noexcept;
-template void agm_process_avx2<float>(const VSFrame* src, VSFrame* dst, float& avg, const AGMData* const VS_RESTRICT d, const VSAPI* vsapi) noexcept;
+template void agm_process_avx2<uint8_t>(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, int width, int height, float scaling, int bits) noexcept;
+template void agm_process_avx2<uint16_t>(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, int width, int height, float scaling, int bits) noexcept;
+template void agm_process_avx2<float>(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, int width, int height, float scaling, int bits) noexcept;
 #endif
\ No newline at end of file
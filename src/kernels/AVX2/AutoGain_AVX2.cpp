@@ -1,9 +1,5 @@
 #ifdef PLUGIN_X86
-#include "../shared.h"
-
-extern void minmaxUC_c(const uint8_t* VS_RESTRICT srcp, uint8_t& dst_min, uint8_t& dst_max, ptrdiff_t stride, const int w, const int h) noexcept;
-extern void minmaxUS_c(const uint8_t* VS_RESTRICT srcp, uint16_t& dst_min, uint16_t& dst_max, ptrdiff_t stride, const int w, const int h) noexcept;
-extern void minmaxF_c(const uint8_t* VS_RESTRICT srcp, float& dst_min, float& dst_max, ptrdiff_t stride, const int w, const int h) noexcept;
+#include "../kernels.h"
 
 void autogainUC_avx2(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept {
     uint8_t pmin, pmax;
@@ -0,0 +1,20 @@
+#ifdef PLUGIN_X86
+#include "../kernels.h"
+
+void hash_stripes_avx2(const uint8_t* VS_RESTRICT data, size_t stripes, uint64_t* VS_RESTRICT acc) noexcept {
+    Vec4uq a = Vec4uq().load(acc);
+    Vec4uq secret = Vec4uq().load(kHashSecret);
+    const Vec4uq step(kHashStep);
+
+    for (size_t i = 0; i < stripes; i++) {
+        const Vec4uq d = Vec4uq().load(data + i * 32);
+        const Vec4uq k = d ^ secret;
+        // lo32(k) * hi32(k) for every lane
+        const Vec4uq product = _mm256_mul_epu32(k, _mm256_srli_epi64(k, 32));
+        a += d + product;
+        secret += step;
+    }
+
+    a.store(acc);
+}
+#endif
\ No newline at end of file
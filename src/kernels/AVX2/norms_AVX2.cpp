@@ -0,0 +1,63 @@
+#ifdef PLUGIN_X86
+#include "../kernels.h"
+
+template <int Q>
+static FORCE_INLINE Vec8f qpow(const Vec8f v, const float q) {
+    if constexpr (Q == 2) {
+        return v * v;
+    } else if constexpr (Q == 3) {
+        return v * v * v;
+    } else if constexpr (Q == 6) {
+        const Vec8f cube = v * v * v;
+        return cube * cube;
+    } else {
+        return select(v > 0.0f, pow(v, q), v);
+    }
+}
+
+FORCE_INLINE void histogram_add(const Vec8f v, NormAccumulator& acc) {
+    alignas(32) int32_t bins[8];
+    const Vec8f scaled = min(max(v * kNormBinScale, 0.0f), static_cast<float>(kNormBins));
+    truncatei(select(is_nan(v), static_cast<float>(kNormBins), scaled)).store_a(bins);
+    for (int i{0}; i < 8; i++) {
+        acc.hist[bins[i]]++;
+    }
+}
+
+template <int Q>
+void norms_row_avx2(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept {
+    Vec8f sum_q0 = zero_8f(), sum_q1 = zero_8f();
+    Vec8f sum30 = zero_8f(), sum31 = zero_8f();
+    Vec8f vmax = zero_8f();
+
+    int x{0};
+    for (; x + 16 <= width; x += 16) {
+        const Vec8f a = abs(Vec8f().load(row + x));
+        const Vec8f b = abs(Vec8f().load(row + x + 8));
+
+        sum_q0 += qpow<Q>(a, q);
+        sum_q1 += qpow<Q>(b, q);
+        sum30 = mul_add(a * a, a, sum30);
+        sum31 = mul_add(b * b, b, sum31);
+        // the accumulator goes last, max returns it when the other operand is NaN
+        vmax = max(b, max(a, vmax));
+
+        histogram_add(a, acc);
+        histogram_add(b, acc);
+    }
+
+    acc.sum_q += static_cast<double>(horizontal_add(sum_q0 + sum_q1));
+    acc.sum3 += static_cast<double>(horizontal_add(sum30 + sum31));
+    acc.max_val = std::max(acc.max_val, static_cast<double>(horizontal_max(vmax)));
+    acc.count += x;
+
+    if (x < width) {
+        norms_row_c<Q>(row + x, width - x, q, acc);
+    }
+}
+
+template void norms_row_avx2<0>(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept;
+template void norms_row_avx2<2>(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept;
+template void norms_row_avx2<3>(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept;
+template void norms_row_avx2<6>(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept;
+#endif
\ No newline at end of file
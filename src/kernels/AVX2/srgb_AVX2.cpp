@@ -0,0 +1,25 @@
+#ifdef PLUGIN_X86
+#include "../kernels.h"
+
+void srgb_to_linear_avx2(const float* VS_RESTRICT srcp, float* VS_RESTRICT dstp, int width) noexcept {
+    const int width8 = width & ~7;
+
+    for (int x = 0; x < width8; x += 8) {
+        const Vec8f src = Vec8f().load(srcp + x);
+        const Vec8f v = abs(src);
+
+        const Vec8f p = mul_add(mul_add(mul_add(mul_add(v, 8.210152774e-01f, 7.961564959e-01f), v, 1.624820318e-01f), v, 1.043637593e-02f), v, 2.200248328e-04f);
+        const Vec8f q = mul_add(mul_add(mul_add(mul_add(v, 6.521209011e-03f, -5.512498495e-02f), v, 4.987528350e-01f), v, 1.076976492e+00f), v, 2.631846970e-01f);
+        Vec8f lin = select(v <= 0.04045f, v * (1.0f / 12.92f), p / q);
+
+        // Rare out of range values take the exact path.
+        if (horizontal_or(v > 1.0f))
+            lin = select(v > 1.0f, pow(mul_add(v, 1.0f / 1.055f, 0.055f / 1.055f), 2.4f), lin);
+
+        sign_combine(lin, src).store(dstp + x);
+    }
+
+    if (width8 < width)
+        srgb_to_linear_c(srcp + width8, dstp + width8, width - width8);
+}
+#endif
\ No newline at end of file
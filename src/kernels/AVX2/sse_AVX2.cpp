@@ -0,0 +1,38 @@
+#ifdef PLUGIN_X86
+#include "../kernels.h"
+
+template <typename T>
+static FORCE_INLINE Vec8f load8(const T* p) {
+    if constexpr (std::is_same_v<T, uint8_t>) {
+        return to_float(Vec8i(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)))));
+    } else if constexpr (std::is_same_v<T, uint16_t>) {
+        return to_float(Vec8i(extend(Vec8us().load(p))));
+    } else {
+        return Vec8f().load(p);
+    }
+}
+
+template <typename T>
+double sse_row_avx2(const uint8_t* VS_RESTRICT a, const uint8_t* VS_RESTRICT b, int width, float scale) noexcept {
+    const T* ap = reinterpret_cast<const T*>(a);
+    const T* bp = reinterpret_cast<const T*>(b);
+    Vec8f sum0 = zero_8f(), sum1 = zero_8f();
+
+    int x{0};
+    for (; x + 16 <= width; x += 16) {
+        const Vec8f d0 = (load8(ap + x) - load8(bp + x)) * scale;
+        const Vec8f d1 = (load8(ap + x + 8) - load8(bp + x + 8)) * scale;
+        sum0 = mul_add(d0, d0, sum0);
+        sum1 = mul_add(d1, d1, sum1);
+    }
+
+    double sum = static_cast<double>(horizontal_add(sum0 + sum1));
+    if (x < width)
+        sum += sse_row_c<T>(a + x * sizeof(T), b + x * sizeof(T), width - x, scale);
+    return sum;
+}
+
+template double sse_row_avx2<uint8_t>(const uint8_t* VS_RESTRICT a, const uint8_t* VS_RESTRICT b, int width, float scale) noexcept;
+template double sse_row_avx2<uint16_t>(const uint8_t* VS_RESTRICT a, const uint8_t* VS_RESTRICT b, int width, float scale) noexcept;
+template double sse_row_avx2<float>(const uint8_t* VS_RESTRICT a, const uint8_t* VS_RESTRICT b, int width, float scale) noexcept;
+#endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifdef PLUGIN_X86
+#include "../kernels.h"
+
+FORCE_INLINE Vec8f linearize_avx2(const Vec8f v, const float* lut) {
+    const Vec8f pos = min(max(v, zero_8f()), 1.0f) * static_cast<float>(kTransferLUTSize);
+    const Vec8i i = min(truncatei(pos), kTransferLUTSize - 1);
+    const Vec8f f = pos - to_float(i);
+    const Vec8f lo = lookup<kTransferLUTSize + 1>(i, lut);
+    const Vec8f hi = lookup<kTransferLUTSize + 1>(i + 1, lut);
+    return mul_add(f, hi - lo, lo);
+}
+
+void yuv_row_to_linear_avx2(const float* VS_RESTRICT yp, const float* VS_RESTRICT up, const float* VS_RESTRICT vp, float* VS_RESTRICT rp, float* VS_RESTRICT gp, float* VS_RESTRICT bp, int width, const YUVConversion& conv) noexcept {
+    const float* lut = conv.eotf;
+    const float* m = conv.primaries;
+    const int width8 = width & ~7;
+
+    for (int x = 0; x < width8; x += 8) {
+        const Vec8f y = Vec8f().load(yp + x);
+        const Vec8f u = Vec8f().load(up + x);
+        const Vec8f v = Vec8f().load(vp + x);
+
+        Vec8f r = linearize_avx2(mul_add(v, conv.cr_v, y), lut);
+        Vec8f g = linearize_avx2(mul_add(v, conv.cg_v, mul_add(u, conv.cg_u, y)), lut);
+        Vec8f b = linearize_avx2(mul_add(u, conv.cb_u, y), lut);
+
+        if (m) {
+            const Vec8f r2 = mul_add(r, m[0], mul_add(g, m[1], b * m[2]));
+            const Vec8f g2 = mul_add(r, m[3], mul_add(g, m[4], b * m[5]));
+            const Vec8f b2 = mul_add(r, m[6], mul_add(g, m[7], b * m[8]));
+            r = r2;
+            g = g2;
+            b = b2;
+        }
+
+        r.store(rp + x);
+        g.store(gp + x);
+        b.store(bp + x);
+    }
+
+    if (width8 < width)
+        yuv_row_to_linear_c(yp + width8, up + width8, vp + width8, rp + width8, gp + width8, bp + width8, width - width8, conv);
+}
+#endif
\ No newline at end of file
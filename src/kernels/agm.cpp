@@ -0,0 +1,68 @@
+#include "kernels.h"
+
+struct alignas(32) AGMCurve final {
+    float v[256];
+};
+
+const float* agm_curve() noexcept {
+    static const AGMCurve curve = [] {
+        AGMCurve c;
+        for (int i{0}; i < 256; i++) {
+            const float x{i / 256.0f};
+            c.v[i] = (1.0f - (x * ((x * ((x * ((x * ((x * 18.188f) - 45.47f)) + 36.624f)) - 9.466f)) + 1.124f)));
+        }
+        return c;
+    }();
+    return curve.v;
+}
+
+template <typename pixel_t>
+void agm_process_c(const uint8_t* VS_RESTRICT srcp8, uint8_t* VS_RESTRICT dstp8, ptrdiff_t stride, int width, int height, float scaling, int bits) noexcept {
+    auto srcp{reinterpret_cast<const pixel_t*>(srcp8)};
+    auto dstp{reinterpret_cast<pixel_t*>(dstp8)};
+    stride /= sizeof(pixel_t);
+
+    if constexpr (std::is_integral_v<pixel_t>) {
+        const int shift{bits - 8};
+        const float peak{static_cast<float>((1 << bits) - 1)};
+        const float* curve = agm_curve();
+        pixel_t lut[256];
+
+        for (int i{0}; i < 256; i++) {
+            lut[i] = static_cast<pixel_t>(std::clamp((std::pow(curve[i], scaling) * peak + 0.5f), 0.0f, peak));
+        }
+
+        for (int y{0}; y < height; y++) {
+            for (int x{0}; x < width; x++) {
+                dstp[x] = lut[srcp[x] >> shift];
+            }
+            srcp += stride;
+            dstp += stride;
+        }
+    } else {
+        for (int y{0}; y < height; y++) {
+            for (int x{0}; x < width; x++) {
+                dstp[x] = std::clamp(std::pow(1.0f - (srcp[x] * ((srcp[x] * ((srcp[x] * ((srcp[x] * ((srcp[x] * 18.188f) - 45.47f)) + 36.624f)) - 9.466f)) + 1.124f)), scaling), 0.0f, 1.0f);
+            }
+            srcp += stride;
+            dstp += stride;
+        }
+    }
+}
+
+AGMFunc select_agm(int bits, JulekISA isa) noexcept {
+#ifdef PLUGIN_X86
+    if (use_avx2(isa)) {
+        if (bits == 32)
+            return agm_process_avx2<float>;
+        return (bits == 8) ? agm_process_avx2<uint8_t> : agm_process_avx2<uint16_t>;
+    }
+#endif
+    if (bits == 32)
+        return agm_process_c<float>;
+    return (bits == 8) ? agm_process_c<uint8_t> : agm_process_c<uint16_t>;
+}
+
+template void agm_process_c<uint8_t>(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, int width, int height, float scaling, int bits) noexcept;
+template void agm_process_c<uint16_t>(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, int width, int height, float scaling, int bits) noexcept;
+template void agm_process_c<float>(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, int width, int height, float scaling, int bits) noexcept;
\ No newline at end of file
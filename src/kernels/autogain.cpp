@@ -0,0 +1,128 @@
+#include "kernels.h"
+
+void minmaxUC_c(const uint8_t* VS_RESTRICT srcp, uint8_t& dst_min, uint8_t& dst_max, ptrdiff_t stride, const int w, const int h) noexcept {
+    uint8_t imin = UCHAR_MAX;
+    uint8_t imax = 0;
+    for (int y{0}; y < h; y++) {
+        for (int x{0}; x < w; x++) {
+            uint8_t v = srcp[x];
+            imin = VSMIN(imin, v);
+            imax = VSMAX(imax, v);
+        }
+        srcp += stride;
+    }
+    dst_min = imin;
+    dst_max = imax;
+}
+
+void minmaxUS_c(const uint8_t* VS_RESTRICT srcp, uint16_t& dst_min, uint16_t& dst_max, ptrdiff_t stride, const int w, const int h) noexcept {
+    uint16_t imin = USHRT_MAX;
+    uint16_t imax = 0;
+    for (int y{0}; y < h; y++) {
+        for (int x{0}; x < w; x++) {
+            uint16_t v = ((const uint16_t*)srcp)[x];
+            imin = VSMIN(imin, v);
+            imax = VSMAX(imax, v);
+        }
+        srcp += stride;
+    }
+    dst_min = imin;
+    dst_max = imax;
+}
+
+void minmaxF_c(const uint8_t* VS_RESTRICT srcp, float& dst_min, float& dst_max, ptrdiff_t stride, const int w, const int h) noexcept {
+    float imin = 1.0f;
+    float imax = 0.0f;
+    for (int y{0}; y < h; y++) {
+        for (int x{0}; x < w; x++) {
+            float v = ((const float*)srcp)[x];
+            imin = VSMIN(imin, v);
+            imax = VSMAX(imax, v);
+        }
+        srcp += stride;
+    }
+    dst_min = imin;
+    dst_max = imax;
+}
+
+void autogainUC_c(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept {
+    uint8_t pmin, pmax;
+    minmaxUC_c(srcp, pmin, pmax, stride, w, h);
+    for (int y{0}; y < h; y++) {
+        for (int x{0}; x < w; x++) {
+            uint8_t v = srcp[x];
+            dstp[x] = (uint8_t)(((v - pmin) / (float)(pmax - pmin)) * 255 + 0.5f);
+        }
+        srcp += stride;
+        dstp += stride;
+    }
+}
+
+template <const uint16_t peak>
+void autogainUS_c(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept {
+    uint16_t pmin, pmax;
+    minmaxUS_c(srcp, pmin, pmax, stride, w, h);
+    for (int y{0}; y < h; y++) {
+        for (int x{0}; x < w; x++) {
+            uint16_t v = ((const uint16_t*)srcp)[x];
+            ((uint16_t*)dstp)[x] = (uint16_t)(((v - pmin) / (float)(pmax - pmin)) * peak + 0.5f);
+        }
+        srcp += stride;
+        dstp += stride;
+    }
+}
+
+void autogainF_c(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept {
+    float pmin, pmax;
+    minmaxF_c(srcp, pmin, pmax, stride, w, h);
+    for (int y{0}; y < h; y++) {
+        for (int x{0}; x < w; x++) {
+            float v = ((const float*)srcp)[x];
+            ((float*)dstp)[x] = (v - pmin) / (pmax - pmin);
+        }
+        srcp += stride;
+        dstp += stride;
+    }
+}
+
+AutoGainFunc select_autogain(int bits, JulekISA isa) noexcept {
+#ifdef PLUGIN_X86
+    if (use_avx2(isa)) {
+        switch (bits) {
+            case 8:
+                return autogainUC_avx2;
+            case 10:
+                return autogainUS_avx2<1023>;
+            case 12:
+                return autogainUS_avx2<4095>;
+            case 14:
+                return autogainUS_avx2<16383>;
+            case 16:
+                return autogainUS_avx2<65535>;
+            case 32:
+                return autogainF_avx2;
+        }
+        return nullptr;
+    }
+#endif
+    switch (bits) {
+        case 8:
+            return autogainUC_c;
+        case 10:
+            return autogainUS_c<1023>;
+        case 12:
+            return autogainUS_c<4095>;
+        case 14:
+            return autogainUS_c<16383>;
+        case 16:
+            return autogainUS_c<65535>;
+        case 32:
+            return autogainF_c;
+    }
+    return nullptr;
+}
+
+template void autogainUS_c<1023>(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+template void autogainUS_c<4095>(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+template void autogainUS_c<16383>(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+template void autogainUS_c<65535>(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "kernels.h"
+
+static FORCE_INLINE uint64_t read64(const uint8_t* p) noexcept {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+void hash_stripes_c(const uint8_t* VS_RESTRICT data, size_t stripes, uint64_t* VS_RESTRICT acc) noexcept {
+    for (size_t i = 0; i < stripes; i++) {
+        const uint64_t offset = i * kHashStep;
+        for (int lane = 0; lane < 4; lane++)
+            hash_mix_word(acc[lane], read64(data + i * 32 + lane * 8), kHashSecret[lane] + offset);
+    }
+}
+
+HashStripesFunc select_hash_stripes(JulekISA isa) noexcept {
+#ifdef PLUGIN_X86
+    if (use_avx2(isa))
+        return hash_stripes_avx2;
+#endif
+    return hash_stripes_c;
+}
\ No newline at end of file
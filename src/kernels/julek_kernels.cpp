@@ -0,0 +1,99 @@
+#include "kernels.h"
+
+bool use_avx2(JulekISA isa) noexcept {
+#ifdef PLUGIN_X86
+    return (isa == JULEK_ISA_BEST || isa == JULEK_ISA_AVX2) && instrset_detect() >= 8;
+#else
+    return false;
+#endif
+}
+
+static bool valid_plane(const void* p, ptrdiff_t stride, int width, int height) noexcept {
+    return p && width > 0 && height > 0 && stride > 0;
+}
+
+template <typename pixel_t>
+static void linear_planes(const uint8_t* const srcp[3], const ptrdiff_t src_stride[3], int bits, bool linput, float* const dstp[3], const ptrdiff_t dst_stride[3], int width, int height, JulekISA isa) noexcept {
+    if (linput)
+        rgb_to_linear<pixel_t, true>(srcp, src_stride, bits, dstp, dst_stride, width, height, isa);
+    else
+        rgb_to_linear<pixel_t, false>(srcp, src_stride, bits, dstp, dst_stride, width, height, isa);
+}
+
+int julek_kernels_api_version(void) {
+    return JULEK_KERNELS_API_VERSION;
+}
+
+int julek_isa_supported(JulekISA isa) {
+    switch (isa) {
+        case JULEK_ISA_BEST:
+        case JULEK_ISA_C:
+            return 1;
+        case JULEK_ISA_AVX2:
+            return use_avx2(isa);
+    }
+    return 0;
+}
+
+int julek_agm_mask(const void* src, void* dst, ptrdiff_t stride, int width, int height, int bits, float average, float luma_scaling, JulekISA isa) {
+    if (!julek_isa_supported(isa) || !valid_plane(src, stride, width, height) || !dst)
+        return -1;
+    if ((bits < 8 || bits > 16) && bits != 32)
+        return -1;
+
+    select_agm(bits, isa)(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), stride, width, height, average * average * luma_scaling, bits);
+    return 0;
+}
+
+int julek_autogain(const void* src, void* dst, ptrdiff_t stride, int width, int height, int bits, JulekISA isa) {
+    if (!julek_isa_supported(isa) || !valid_plane(src, stride, width, height) || !dst)
+        return -1;
+
+    const AutoGainFunc process = select_autogain(bits, isa);
+    if (!process)
+        return -1;
+    process(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), stride, width, height);
+    return 0;
+}
+
+int julek_colormap(const uint8_t* src, ptrdiff_t src_stride, uint8_t* const dst[3], ptrdiff_t dst_stride, int width, int height, int type) {
+    if (!valid_plane(src, src_stride, width, height) || !dst || !dst[0] || !dst[1] || !dst[2] || dst_stride <= 0)
+        return -1;
+    if (type < 0 || type >= kColorMaps)
+        return -1;
+
+    colormap_process(src, src_stride, dst, dst_stride, width, height, type);
+    return 0;
+}
+
+int julek_rgb_to_linear(const void* const src[3], const ptrdiff_t src_stride[3], int bits, int linear_input, float* const dst[3], const ptrdiff_t dst_stride[3], int width, int height, JulekISA isa) {
+    if (!julek_isa_supported(isa) || !src || !src_stride || !dst || !dst_stride)
+        return -1;
+    for (int i = 0; i < 3; ++i) {
+        if (!valid_plane(src[i], src_stride[i], width, height) || !dst[i] || dst_stride[i] <= 0)
+            return -1;
+    }
+
+    const uint8_t* const srcp[3] = {static_cast<const uint8_t*>(src[0]), static_cast<const uint8_t*>(src[1]), static_cast<const uint8_t*>(src[2])};
+    if (bits == 8) {
+        linear_planes<uint8_t>(srcp, src_stride, bits, linear_input, dst, dst_stride, width, height, isa);
+    } else if (bits > 8 && bits <= 16) {
+        linear_planes<uint16_t>(srcp, src_stride, bits, linear_input, dst, dst_stride, width, height, isa);
+    } else if (bits == 32) {
+        linear_planes<float>(srcp, src_stride, bits, linear_input, dst, dst_stride, width, height, isa);
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+int julek_butteraugli_norms(const float* diff_map, ptrdiff_t stride, int width, int height, double q, JulekNorms* norms, JulekISA isa) {
+    if (!julek_isa_supported(isa) || !valid_plane(diff_map, stride, width, height) || !norms || !(q > 0.0) || !std::isfinite(q))
+        return -1;
+
+    NormAccumulator acc;
+    accumulate_norms(diff_map, stride, width, height, q, acc, isa);
+    const ButteraugliNorms n = finish_norms(acc, q);
+    *norms = {n.norm_q, n.norm3, n.norm_inf, n.p95, n.p99};
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#ifndef JULEK_KERNELS_H
+#define JULEK_KERNELS_H
+
+/* Pixel kernels of the julek plugin, usable without VapourSynth.
+ *
+ * Planes are passed as a pointer to the first row and a stride in bytes. Integer samples are uint8_t for 8 bit
+ * and uint16_t for 9-16 bit, float samples are 32 bit. The AVX2 paths read and write whole vectors past the
+ * width, so planes must be laid out like VapourSynth frames: 32 byte aligned rows, a stride that's a multiple of
+ * 32 bytes and padding up to the stride that can be read and written. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define JULEK_KERNELS_API_VERSION 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum JulekISA {
+    JULEK_ISA_BEST = 0, /* the fastest version the CPU supports */
+    JULEK_ISA_C = 1,
+    JULEK_ISA_AVX2 = 2
+} JulekISA;
+
+typedef struct JulekNorms {
+    double norm_q, norm3, norm_inf;
+    double p95, p99; /* upper edge of the 1/128 wide histogram bin, at most norm_inf */
+} JulekNorms;
+
+/* The functions below return 0 on success and -1 for invalid arguments or an isa the CPU doesn't support. */
+
+int julek_kernels_api_version(void);
+/* 1 when the kernels can run with isa on this CPU. */
+int julek_isa_supported(JulekISA isa);
+
+/* AGM grain mask of one plane (bits 8-16 or 32 for float), as julek.AGM. average is the mean of the luma plane
+ * in [0, 1]. src and dst share the stride. */
+int julek_agm_mask(const void* src, void* dst, ptrdiff_t stride, int width, int height, int bits, float average, float luma_scaling, JulekISA isa);
+
+/* Stretches one plane to the full range (bits 8, 10, 12, 14, 16 or 32 for float), as julek.AutoGain. src and dst
+ * share the stride. */
+int julek_autogain(const void* src, void* dst, ptrdiff_t stride, int width, int height, int bits, JulekISA isa);
+
+/* Maps an 8 bit plane to 8 bit R, G and B planes with one of the 22 julek.ColorMap palettes. */
+int julek_colormap(const uint8_t* src, ptrdiff_t src_stride, uint8_t* const dst[3], ptrdiff_t dst_stride, int width, int height, int type);
+
+/* Converts an RGB image (bits 8-16 or 32 for float) to linear float planes, from sRGB or, with linear_input,
+ * only normalized. This is the conversion the metrics run on RGB input. */
+int julek_rgb_to_linear(const void* const src[3], const ptrdiff_t src_stride[3], int bits, int linear_input, float* const dst[3], const ptrdiff_t dst_stride[3], int width, int height, JulekISA isa);
+
+/* Norms of a Butteraugli diff map, as the _BUTTERAUGLI_* props. q is the qnorm exponent, finite and greater
+ * than 0. Any float is accepted in the map and its absolute value is used: NaN and inf turn norm_q and norm3 into
+ * NaN and inf, norm_inf ignores NaN, and the percentiles count NaN and values of 32 or more in the top bin. */
+int julek_butteraugli_norms(const float* diff_map, ptrdiff_t stride, int width, int height, double q, JulekNorms* norms, JulekISA isa);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+
+// Kernels behind julek_kernels.h, shared by the plugin filters. Planes are plain pointers with byte strides,
+// nothing here knows about VSFrame or VSAPI.
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "julek_kernels.h"
+#include "vapoursynth/VSHelper4.h"
+
+#ifdef PLUGIN_X86
+#include "vectorclass.h"
+#include "vectormath_exp.h"
+#endif
+
+#if defined(_MSC_VER)
+#define FORCE_INLINE inline __forceinline
+#else
+#define FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+// True when the AVX2 version of a kernel should run for isa.
+bool use_avx2(JulekISA isa) noexcept;
+
+// AGM: scaling is average^2 * luma_scaling.
+using AGMFunc = void (*)(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, int width, int height, float scaling, int bits) noexcept;
+// 1 - the AGM polynomial at i / 256, 32 byte aligned.
+const float* agm_curve() noexcept;
+template <typename pixel_t>
+void agm_process_c(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, int width, int height, float scaling, int bits) noexcept;
+template <typename pixel_t>
+void agm_process_avx2(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, int width, int height, float scaling, int bits) noexcept;
+// bits 32 selects the float kernel.
+AGMFunc select_agm(int bits, JulekISA isa = JULEK_ISA_BEST) noexcept;
+
+using AutoGainFunc = void (*)(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+void minmaxUC_c(const uint8_t* VS_RESTRICT srcp, uint8_t& dst_min, uint8_t& dst_max, ptrdiff_t stride, const int w, const int h) noexcept;
+void minmaxUS_c(const uint8_t* VS_RESTRICT srcp, uint16_t& dst_min, uint16_t& dst_max, ptrdiff_t stride, const int w, const int h) noexcept;
+void minmaxF_c(const uint8_t* VS_RESTRICT srcp, float& dst_min, float& dst_max, ptrdiff_t stride, const int w, const int h) noexcept;
+void autogainUC_c(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+template <const uint16_t peak>
+void autogainUS_c(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+void autogainF_c(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+void autogainUC_avx2(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+template <const uint16_t peak>
+void autogainUS_avx2(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+void autogainF_avx2(const uint8_t* VS_RESTRICT srcp, uint8_t* VS_RESTRICT dstp, ptrdiff_t stride, const int w, const int h) noexcept;
+// nullptr for bit depths other than 8, 10, 12, 14, 16 and 32.
+AutoGainFunc select_autogain(int bits, JulekISA isa = JULEK_ISA_BEST) noexcept;
+
+constexpr int kColorMaps = 22;
+void colormap_process(const uint8_t* VS_RESTRICT srcp, ptrdiff_t src_stride, uint8_t* const dstp[3], ptrdiff_t dst_stride, const int w, const int h, int type) noexcept;
+
+// Exact sRGB -> linear tables for every integer bit depth, built on first use.
+const float* srgb_lut(int bits) noexcept;
+using LinearizeRowFunc = void (*)(const float* VS_RESTRICT srcp, float* VS_RESTRICT dstp, int width) noexcept;
+void srgb_to_linear_c(const float* VS_RESTRICT srcp, float* VS_RESTRICT dstp, int width) noexcept;
+void srgb_to_linear_avx2(const float* VS_RESTRICT srcp, float* VS_RESTRICT dstp, int width) noexcept;
+LinearizeRowFunc select_srgb_to_linear(JulekISA isa = JULEK_ISA_BEST) noexcept;
+// Linear float planes from RGB planes, bits is ignored for float input.
+template <typename pixel_t, bool linput>
+void rgb_to_linear(const uint8_t* const srcp[3], const ptrdiff_t src_stride[3], int bits, float* const dstp[3], const ptrdiff_t dst_stride[3], int width, int height, JulekISA isa = JULEK_ISA_BEST) noexcept;
+
+constexpr int kTransferLUTSize = 4096;
+
+// Y'CbCr -> linear RGB of one row, set up by yuv_conversion from the frame's matrix, range, transfer and primaries.
+struct YUVConversion;
+using YUVRowFunc = void (*)(const float* VS_RESTRICT yp, const float* VS_RESTRICT up, const float* VS_RESTRICT vp, float* VS_RESTRICT rp, float* VS_RESTRICT gp, float* VS_RESTRICT bp, int width, const YUVConversion& conv) noexcept;
+
+struct YUVConversion final {
+    float y_offset, y_scale;
+    float c_offset, c_scale;
+    float kr, kb;
+    float cr_v, cg_u, cg_v, cb_u;
+    int ss_w, ss_h;
+    float cx_offset, cy_offset;  // position of the first luma sample on the chroma grid
+    const float* eotf;           // kTransferLUTSize + 1 entries
+    const float* primaries;      // 3x3 conversion to BT.709 primaries, nullptr if not needed
+    YUVRowFunc row;
+};
+
+void yuv_row_to_linear_c(const float* VS_RESTRICT yp, const float* VS_RESTRICT up, const float* VS_RESTRICT vp, float* VS_RESTRICT rp, float* VS_RESTRICT gp, float* VS_RESTRICT bp, int width, const YUVConversion& conv) noexcept;
+void yuv_row_to_linear_avx2(const float* VS_RESTRICT yp, const float* VS_RESTRICT up, const float* VS_RESTRICT vp, float* VS_RESTRICT rp, float* VS_RESTRICT gp, float* VS_RESTRICT bp, int width, const YUVConversion& conv) noexcept;
+YUVRowFunc select_yuv_row(JulekISA isa = JULEK_ISA_BEST) noexcept;
+
+// The diff map histogram behind the percentile props: bins of 1/128 up to 32, values above go to the last bin.
+constexpr int kNormBins = 4096;
+constexpr float kNormBinScale = 128.0f;
+
+// Running sums behind compute_norms, so a diff map can also be reduced piece by piece.
+struct NormAccumulator final {
+    double sum_q = 0.0;    // Sum of q-powers for q-norm
+    double sum3 = 0.0;     // Sum of cubes for L3-norm
+    double max_val = 0.0;  // For L∞-norm (max)
+    size_t count = 0;
+    std::array<uint32_t, kNormBins + 1> hist{};
+};
+
+struct ButteraugliNorms final {
+    double norm_q, norm3, norm_inf;
+    double p95, p99;  // upper edge of the histogram bin, at most norm_inf
+};
+
+// Adds one row of the diff map. Q is 2, 3 or 6 for the multiplication-only kernels, 0 for any other q.
+using NormRowFunc = void (*)(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept;
+template <int Q>
+void norms_row_c(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept;
+template <int Q>
+void norms_row_avx2(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept;
+NormRowFunc select_norms_row(double q, JulekISA isa = JULEK_ISA_BEST) noexcept;
+
+// stride in bytes.
+void accumulate_norms(const float* map, ptrdiff_t stride, int width, int height, double q, NormAccumulator& acc, JulekISA isa = JULEK_ISA_BEST) noexcept;
+ButteraugliNorms finish_norms(const NormAccumulator& acc, double q) noexcept;
+
+// Sum of squared differences of one row, integer samples are normalized to [0, 1] by scale.
+using SSERowFunc = double (*)(const uint8_t* VS_RESTRICT a, const uint8_t* VS_RESTRICT b, int width, float scale) noexcept;
+template <typename T>
+double sse_row_c(const uint8_t* VS_RESTRICT a, const uint8_t* VS_RESTRICT b, int width, float scale) noexcept;
+template <typename T>
+double sse_row_avx2(const uint8_t* VS_RESTRICT a, const uint8_t* VS_RESTRICT b, int width, float scale) noexcept;
+// bytes_per_sample 4 selects the float kernel.
+SSERowFunc select_sse_row(int bytes_per_sample, JulekISA isa = JULEK_ISA_BEST) noexcept;
+
+// Content hash of the score cache: 32 byte stripes go into four 64 bit lanes, the secret of stripe i is offset by
+// i * kHashStep so stripes swapped within a row change the hash.
+inline constexpr uint64_t kHashSecret[4] = {0xbe4ba423396cfeb8ULL, 0x1cad21f72c81017cULL, 0xdb979083e96dd4deULL, 0x1f67b3b7a4a44072ULL};
+inline constexpr uint64_t kHashStep = 0x27d4eb2f165667c5ULL;
+
+// acc += word + lo32(word ^ secret) * hi32(word ^ secret)
+FORCE_INLINE void hash_mix_word(uint64_t& acc, uint64_t word, uint64_t secret) noexcept {
+    const uint64_t k = word ^ secret;
+    acc += word + (k & 0xffffffffULL) * (k >> 32);
+}
+
+using HashStripesFunc = void (*)(const uint8_t* VS_RESTRICT data, size_t stripes, uint64_t* VS_RESTRICT acc) noexcept;
+void hash_stripes_c(const uint8_t* VS_RESTRICT data, size_t stripes, uint64_t* VS_RESTRICT acc) noexcept;
+void hash_stripes_avx2(const uint8_t* VS_RESTRICT data, size_t stripes, uint64_t* VS_RESTRICT acc) noexcept;
+// Both versions give the same hash.
+HashStripesFunc select_hash_stripes(JulekISA isa = JULEK_ISA_BEST) noexcept;
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include <mutex>
+#include <vector>
+
+#include "kernels.h"
+
+static FORCE_INLINE float srgb_to_linear(float v) noexcept {
+    return (v <= 0.04045f) ? v / 12.92f : std::pow((v + 0.055f) / 1.055f, 2.4f);
+}
+
+const float* srgb_lut(int bits) noexcept {
+    static std::once_flag once[17];
+    static std::vector<float> luts[17];
+
+    std::call_once(once[bits], [bits] {
+        const int peak = (1 << bits) - 1;
+        luts[bits].resize(peak + 1);
+        for (int i = 0; i <= peak; i++) {
+            luts[bits][i] = srgb_to_linear(static_cast<float>(i) / peak);
+        }
+    });
+    return luts[bits].data();
+}
+
+// 4/4 rational approximation of the sRGB EOTF (max relative error 7.5e-6), sign-preserving like the jxl CMS.
+void srgb_to_linear_c(const float* VS_RESTRICT srcp, float* VS_RESTRICT dstp, int width) noexcept {
+    for (int x = 0; x < width; x++) {
+        const float v = std::abs(srcp[x]);
+        float lin;
+
+        if (v <= 0.04045f) {
+            lin = v * (1.0f / 12.92f);
+        } else if (v <= 1.0f) {
+            const float p = 2.200248328e-04f + v * (1.043637593e-02f + v * (1.624820318e-01f + v * (7.961564959e-01f + v * 8.210152774e-01f)));
+            const float q = 2.631846970e-01f + v * (1.076976492e+00f + v * (4.987528350e-01f + v * (-5.512498495e-02f + v * 6.521209011e-03f)));
+            lin = p / q;
+        } else {
+            lin = srgb_to_linear(v);
+        }
+
+        dstp[x] = std::copysign(lin, srcp[x]);
+    }
+}
+
+LinearizeRowFunc select_srgb_to_linear(JulekISA isa) noexcept {
+#ifdef PLUGIN_X86
+    if (use_avx2(isa))
+        return srgb_to_linear_avx2;
+#endif
+    return srgb_to_linear_c;
+}
+
+void yuv_row_to_linear_c(const float* VS_RESTRICT yp, const float* VS_RESTRICT up, const float* VS_RESTRICT vp, float* VS_RESTRICT rp, float* VS_RESTRICT gp, float* VS_RESTRICT bp, int width, const YUVConversion& conv) noexcept {
+    const float* lut = conv.eotf;
+
+    auto linearize = [lut](float v) {
+        const float pos = std::clamp(v, 0.0f, 1.0f) * kTransferLUTSize;
+        const int i = std::min(static_cast<int>(pos), kTransferLUTSize - 1);
+        const float f = pos - i;
+        return lut[i] + f * (lut[i + 1] - lut[i]);
+    };
+
+    for (int x = 0; x < width; x++) {
+        const float y = yp[x];
+        const float u = up[x];
+        const float v = vp[x];
+
+        rp[x] = linearize(y + conv.cr_v * v);
+        gp[x] = linearize(y + conv.cg_u * u + conv.cg_v * v);
+        bp[x] = linearize(y + conv.cb_u * u);
+    }
+
+    if (conv.primaries) {
+        const float* m = conv.primaries;
+        for (int x = 0; x < width; x++) {
+            const float r = rp[x];
+            const float g = gp[x];
+            const float b = bp[x];
+
+            rp[x] = m[0] * r + m[1] * g + m[2] * b;
+            gp[x] = m[3] * r + m[4] * g + m[5] * b;
+            bp[x] = m[6] * r + m[7] * g + m[8] * b;
+        }
+    }
+}
+
+YUVRowFunc select_yuv_row(JulekISA isa) noexcept {
+#ifdef PLUGIN_X86
+    if (use_avx2(isa))
+        return yuv_row_to_linear_avx2;
+#endif
+    return yuv_row_to_linear_c;
+}
+
+template <typename pixel_t, bool linput>
+void rgb_to_linear(const uint8_t* const srcp[3], const ptrdiff_t src_stride[3], int bits, float* const dstp[3], const ptrdiff_t dst_stride[3], int width, int height, JulekISA isa) noexcept {
+    if constexpr (std::is_integral_v<pixel_t>) {
+        const pixel_t peak = static_cast<pixel_t>((1 << bits) - 1);
+        const float scale = 1.0f / peak;
+        const float* lut = srgb_lut(bits);
+
+        for (int i = 0; i < 3; ++i) {
+            const uint8_t* src = srcp[i];
+            uint8_t* dst = reinterpret_cast<uint8_t*>(dstp[i]);
+
+            for (int y = 0; y < height; ++y) {
+                const pixel_t* VS_RESTRICT s = reinterpret_cast<const pixel_t*>(src);
+                float* VS_RESTRICT row = reinterpret_cast<float*>(dst);
+
+                for (int x = 0; x < width; ++x) {
+                    if constexpr (linput) {
+                        row[x] = s[x] * scale;
+                    } else {
+                        row[x] = lut[std::min(s[x], peak)];
+                    }
+                }
+
+                src += src_stride[i];
+                dst += dst_stride[i];
+            }
+        }
+    } else {
+        const LinearizeRowFunc linearize = select_srgb_to_linear(isa);
+
+        for (int i = 0; i < 3; ++i) {
+            const uint8_t* src = srcp[i];
+            uint8_t* dst = reinterpret_cast<uint8_t*>(dstp[i]);
+
+            for (int y = 0; y < height; ++y) {
+                if constexpr (linput) {
+                    memcpy(dst, src, width * sizeof(float));
+                } else {
+                    linearize(reinterpret_cast<const float*>(src), reinterpret_cast<float*>(dst), width);
+                }
+                src += src_stride[i];
+                dst += dst_stride[i];
+            }
+        }
+    }
+}
+
+template void rgb_to_linear<uint8_t, true>(const uint8_t* const srcp[3], const ptrdiff_t src_stride[3], int bits, float* const dstp[3], const ptrdiff_t dst_stride[3], int width, int height, JulekISA isa) noexcept;
+template void rgb_to_linear<uint16_t, true>(const uint8_t* const srcp[3], const ptrdiff_t src_stride[3], int bits, float* const dstp[3], const ptrdiff_t dst_stride[3], int width, int height, JulekISA isa) noexcept;
+template void rgb_to_linear<float, true>(const uint8_t* const srcp[3], const ptrdiff_t src_stride[3], int bits, float* const dstp[3], const ptrdiff_t dst_stride[3], int width, int height, JulekISA isa) noexcept;
+
+template void rgb_to_linear<uint8_t, false>(const uint8_t* const srcp[3], const ptrdiff_t src_stride[3], int bits, float* const dstp[3], const ptrdiff_t dst_stride[3], int width, int height, JulekISA isa) noexcept;
+template void rgb_to_linear<uint16_t, false>(const uint8_t* const srcp[3], const ptrdiff_t src_stride[3], int bits, float* const dstp[3], const ptrdiff_t dst_stride[3], int width, int height, JulekISA isa) noexcept;
+template void rgb_to_linear<float, false>(const uint8_t* const srcp[3], const ptrdiff_t src_stride[3], int bits, float* const dstp[3], const ptrdiff_t dst_stride[3], int width, int height, JulekISA isa) noexcept;
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "kernels.h"
+
+template <int Q>
+static FORCE_INLINE float qpow(float v, float q) noexcept {
+    if constexpr (Q == 2) {
+        return v * v;
+    } else if constexpr (Q == 3) {
+        return v * v * v;
+    } else if constexpr (Q == 6) {
+        const float cube = v * v * v;
+        return cube * cube;
+    } else {
+        // v is an absolute value, so anything not above 0 is 0 or NaN and is passed on as is.
+        return (v > 0.0f) ? std::exp2(q * std::log2(v)) : v;
+    }
+}
+
+// NaN goes to the top bin, everything else is clamped while still a float so inf and huge values can't overflow
+// the int conversion.
+static FORCE_INLINE int norm_bin(float v) noexcept {
+    if (v != v)
+        return kNormBins;
+    return static_cast<int>(std::min(std::max(v * kNormBinScale, 0.0f), static_cast<float>(kNormBins)));
+}
+
+// Four independent partial sums per quantity break the add dependency chain, a row's sums are folded into the
+// double precision totals once the row is done.
+template <int Q>
+void norms_row_c(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept {
+    float sum_q[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    float sum3[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    float max_val = static_cast<float>(acc.max_val);
+
+    int x = 0;
+    for (; x + 4 <= width; x += 4) {
+        for (int i = 0; i < 4; i++) {
+            const float v = std::abs(row[x + i]);
+            sum_q[i] += qpow<Q>(v, q);
+            sum3[i] += v * v * v;
+            max_val = std::max(max_val, v);
+            acc.hist[norm_bin(v)]++;
+        }
+    }
+    for (; x < width; x++) {
+        const float v = std::abs(row[x]);
+        sum_q[0] += qpow<Q>(v, q);
+        sum3[0] += v * v * v;
+        max_val = std::max(max_val, v);
+        acc.hist[norm_bin(v)]++;
+    }
+
+    acc.sum_q += static_cast<double>(sum_q[0] + sum_q[1]) + static_cast<double>(sum_q[2] + sum_q[3]);
+    acc.sum3 += static_cast<double>(sum3[0] + sum3[1]) + static_cast<double>(sum3[2] + sum3[3]);
+    acc.max_val = max_val;
+    acc.count += width;
+}
+
+NormRowFunc select_norms_row(double q, JulekISA isa) noexcept {
+#ifdef PLUGIN_X86
+    if (use_avx2(isa)) {
+        if (q == 2.0) return norms_row_avx2<2>;
+        if (q == 3.0) return norms_row_avx2<3>;
+        if (q == 6.0) return norms_row_avx2<6>;
+        return norms_row_avx2<0>;
+    }
+#endif
+    if (q == 2.0) return norms_row_c<2>;
+    if (q == 3.0) return norms_row_c<3>;
+    if (q == 6.0) return norms_row_c<6>;
+    return norms_row_c<0>;
+}
+
+void accumulate_norms(const float* map, ptrdiff_t stride, int width, int height, double q, NormAccumulator& acc, JulekISA isa) noexcept {
+    const NormRowFunc row_func = select_norms_row(q, isa);
+    const uint8_t* row = reinterpret_cast<const uint8_t*>(map);
+
+    for (int y = 0; y < height; ++y) {
+        row_func(reinterpret_cast<const float*>(row), width, static_cast<float>(q), acc);
+        row += stride;
+    }
+}
+
+static double percentile(const NormAccumulator& acc, double p) noexcept {
+    const uint64_t target = static_cast<uint64_t>(std::ceil(p * acc.count));
+    uint64_t seen = 0;
+
+    for (int i = 0; i < kNormBins; i++) {
+        seen += acc.hist[i];
+        if (seen >= target)
+            return std::min((i + 1) / static_cast<double>(kNormBinScale), acc.max_val);
+    }
+    return acc.max_val;
+}
+
+ButteraugliNorms finish_norms(const NormAccumulator& acc, double q) noexcept {
+    ButteraugliNorms norms{};
+    if (acc.count == 0)
+        return norms;
+
+    norms.norm_q = std::pow(acc.sum_q / acc.count, 1.0 / q);
+    norms.norm3 = std::pow(acc.sum3 / acc.count, 1.0 / 3.0);
+    norms.norm_inf = acc.max_val;  // Maximum absolute value (L∞-norm)
+    norms.p95 = percentile(acc, 0.95);
+    norms.p99 = percentile(acc, 0.99);
+    return norms;
+}
+
+template void norms_row_c<0>(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept;
+template void norms_row_c<2>(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept;
+template void norms_row_c<3>(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept;
+template void norms_row_c<6>(const float* VS_RESTRICT row, int width, float q, NormAccumulator& acc) noexcept;
\ No newline at end of file
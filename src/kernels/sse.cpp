@@ -0,0 +1,31 @@
+#include "kernels.h"
+
+template <typename T>
+double sse_row_c(const uint8_t* VS_RESTRICT a, const uint8_t* VS_RESTRICT b, int width, float scale) noexcept {
+    const T* ap = reinterpret_cast<const T*>(a);
+    const T* bp = reinterpret_cast<const T*>(b);
+    double sum = 0.0;
+
+    for (int x = 0; x < width; x++) {
+        const float diff = (static_cast<float>(ap[x]) - static_cast<float>(bp[x])) * scale;
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+SSERowFunc select_sse_row(int bytes_per_sample, JulekISA isa) noexcept {
+#ifdef PLUGIN_X86
+    if (use_avx2(isa)) {
+        if (bytes_per_sample == 1) return sse_row_avx2<uint8_t>;
+        if (bytes_per_sample == 2) return sse_row_avx2<uint16_t>;
+        return sse_row_avx2<float>;
+    }
+#endif
+    if (bytes_per_sample == 1) return sse_row_c<uint8_t>;
+    if (bytes_per_sample == 2) return sse_row_c<uint16_t>;
+    return sse_row_c<float>;
+}
+
+template double sse_row_c<uint8_t>(const uint8_t* VS_RESTRICT a, const uint8_t* VS_RESTRICT b, int width, float scale) noexcept;
+template double sse_row_c<uint16_t>(const uint8_t* VS_RESTRICT a, const uint8_t* VS_RESTRICT b, int width, float scale) noexcept;
+template double sse_row_c<float>(const uint8_t* VS_RESTRICT a, const uint8_t* VS_RESTRICT b, int width, float scale) noexcept;
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include "shared.h"
+
+// Size-class pool behind every JxlMemoryManager of the plugin. Each block carries a small header with its class
+// and the instance it's charged to, freed blocks are kept per class and handed out again instead of going back
+// to malloc, as long as the cache stays small and the memory budget isn't exceeded.
+
+constexpr size_t kHeaderSize = 64;  // keeps the malloc alignment of the payload
+constexpr int kMinClassExp = 7;
+constexpr int kNumClasses = (48 - kMinClassExp) * 4;
+constexpr size_t kMaxCachedBytes = size_t(256) << 20;
+
+struct BlockHeader final {
+    MemoryStats* stats;
+    size_t bytes;
+    int size_class;
+};
+
+static_assert(sizeof(BlockHeader) <= kHeaderSize, "block header doesn't fit");
+
+struct SizeClassPool final {
+    std::mutex mutex;
+    std::vector<void*> blocks[kNumClasses];
+    size_t cached = 0;
+};
+
+static SizeClassPool& pool() noexcept {
+    static SizeClassPool p;
+    return p;
+}
+
+static std::atomic<int64_t> g_live{0};
+static std::atomic<int64_t> g_idle{0};  // part of g_live held by idle workspaces
+static std::atomic<int64_t> g_budget{0};
+
+static std::mutex g_budget_mutex;
+static std::condition_variable g_budget_cv;
+static int g_frames_in_flight = 0;
+
+// Four classes per power of two, so rounding wastes at most 25%.
+static int size_class(size_t size, size_t& class_bytes) noexcept {
+    size = std::max(size, size_t(1) << (kMinClassExp + 1));
+
+    int exp = kMinClassExp;
+    while (((size - 1) >> (exp + 1)) != 0)
+        exp++;
+
+    const size_t step = size_t(1) << (exp - 2);
+    const size_t quarter = ((size - 1) - (size_t(1) << exp)) / step;
+    class_bytes = (size_t(1) << exp) + (quarter + 1) * step;
+    return (exp - kMinClassExp) * 4 + static_cast<int>(quarter);
+}
+
+static void update_peak(std::atomic<int64_t>& peak, int64_t value) noexcept {
+    int64_t prev = peak.load(std::memory_order_relaxed);
+    while (prev < value && !peak.compare_exchange_weak(prev, value, std::memory_order_relaxed)) {
+    }
+}
+
+static void* pool_alloc(void* opaque, size_t size) {
+    auto stats = static_cast<MemoryStats*>(opaque);
+    size_t class_bytes;
+    const int cls = size_class(size + kHeaderSize, class_bytes);
+
+    void* block = nullptr;
+    if (cls < kNumClasses) {
+        SizeClassPool& p = pool();
+        std::lock_guard<std::mutex> lock(p.mutex);
+        if (!p.blocks[cls].empty()) {
+            block = p.blocks[cls].back();
+            p.blocks[cls].pop_back();
+            p.cached -= class_bytes;
+        }
+    }
+
+    if (!block) {
+        block = malloc(class_bytes);
+        if (!block)
+            return nullptr;
+    }
+
+    auto header = static_cast<BlockHeader*>(block);
+    header->stats = stats;
+    header->bytes = class_bytes;
+    header->size_class = cls;
+
+    const int64_t bytes = static_cast<int64_t>(class_bytes);
+    update_peak(stats->peak, stats->live.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    stats->allocations.fetch_add(1, std::memory_order_relaxed);
+    g_live.fetch_add(bytes, std::memory_order_relaxed);
+
+    return static_cast<uint8_t*>(block) + kHeaderSize;
+}
+
+static void pool_free(void* opaque, void* address) {
+    if (!address)
+        return;
+
+    void* block = static_cast<uint8_t*>(address) - kHeaderSize;
+    auto header = static_cast<BlockHeader*>(block);
+    const size_t bytes = header->bytes;
+    const int cls = header->size_class;
+
+    header->stats->live.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+    const int64_t live = g_live.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed) - static_cast<int64_t>(bytes);
+    const int64_t budget = g_budget.load(std::memory_order_relaxed);
+
+    bool cached = false;
+    if (cls < kNumClasses) {
+        SizeClassPool& p = pool();
+        std::lock_guard<std::mutex> lock(p.mutex);
+        // Cached blocks are still resident, under a budget they're only kept while there's room for them.
+        const bool fits = p.cached + bytes <= kMaxCachedBytes && (!budget || live + static_cast<int64_t>(p.cached + bytes) <= budget);
+        if (fits) {
+            p.blocks[cls].push_back(block);
+            p.cached += bytes;
+            cached = true;
+        }
+    }
+
+    if (!cached)
+        free(block);
+}
+
+MemoryStats::MemoryStats() noexcept : manager{this, pool_alloc, pool_free} {}
+
+JxlMemoryManager* get_memory_manager() {
+    static MemoryStats stats;
+    return &stats.manager;
+}
+
+void set_memory_props(VSMap* props, const char* prefix, const MemoryStats& stats, const VSAPI* vsapi) noexcept {
+    const std::string p = prefix;
+    const int64_t frames = std::max<int64_t>(stats.frames.load(std::memory_order_relaxed), 1);
+
+    vsapi->mapSetInt(props, (p + "_MemoryLive").c_str(), stats.live.load(std::memory_order_relaxed), maReplace);
+    vsapi->mapSetInt(props, (p + "_MemoryPeak").c_str(), stats.peak.load(std::memory_order_relaxed), maReplace);
+    vsapi->mapSetFloat(props, (p + "_AllocationsPerFrame").c_str(), static_cast<double>(stats.allocations.load(std::memory_order_relaxed)) / frames, maReplace);
+}
+
+// Memory allocated through the pool and not parked in an idle workspace.
+static int64_t memory_in_use() noexcept {
+    return g_live.load(std::memory_order_relaxed) - g_idle.load(std::memory_order_relaxed);
+}
+
+void memory_idle_add(int64_t bytes) noexcept {
+    g_idle.fetch_add(bytes, std::memory_order_relaxed);
+    // More idle memory can bring the memory in use under the budget.
+    if (bytes > 0 && g_budget.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(g_budget_mutex);
+        g_budget_cv.notify_all();
+    }
+}
+
+bool memory_over_budget() noexcept {
+    const int64_t budget = g_budget.load(std::memory_order_relaxed);
+    return budget && memory_in_use() >= budget;
+}
+
+// Frames wait while the memory in use is over budget, unless nothing else is running: a single frame larger than
+// the budget still gets to run alone instead of deadlocking. Idle workspaces don't count, a frame picking one up
+// reuses its memory rather than adding to it.
+//
+// Unlike the metric lanes, this parks a worker thread, which upstream filters could otherwise use. That's the price of
+// a hard cap the user asked for with SetMemoryBudget, and it stays bounded: the guard is only taken in
+// arAllFramesReady, so the frames it waits for already hold all of their input and finish without any other worker, and
+// for Butteraugli and SSIMULACRA the lanes (max_inflight) cap how many frames can be waiting at once. Without a budget
+// nothing waits.
+MemoryBudgetGuard::MemoryBudgetGuard(MemoryStats& stats) noexcept {
+    stats.frames.fetch_add(1, std::memory_order_relaxed);
+
+    std::unique_lock<std::mutex> lock(g_budget_mutex);
+    g_budget_cv.wait(lock, [] {
+        const int64_t budget = g_budget.load(std::memory_order_relaxed);
+        return !budget || !g_frames_in_flight || memory_in_use() < budget;
+    });
+    g_frames_in_flight++;
+}
+
+MemoryBudgetGuard::~MemoryBudgetGuard() {
+    {
+        std::lock_guard<std::mutex> lock(g_budget_mutex);
+        g_frames_in_flight--;
+    }
+    g_budget_cv.notify_all();
+}
+
+void VS_CC memorybudgetCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi) {
+    int err{0};
+
+    int64_t mb = vsapi->mapGetInt(in, "mb", 0, &err);
+    if (err)
+        mb = 0;
+
+    if (mb < 0) {
+        vsapi->mapSetError(out, "SetMemoryBudget: mb must be 0 (unlimited) or greater.");
+        return;
+    }
+    if (mb > (INT64_MAX >> 20)) {
+        vsapi->mapSetError(out, ("SetMemoryBudget: mb can't be more than " + std::to_string(INT64_MAX >> 20) + ".").c_str());
+        return;
+    }
+
+    g_budget.store(mb << 20, std::memory_order_relaxed);
+    g_budget_cv.notify_all();
+
+    // Drop whatever the cache holds beyond the new budget.
+    if (mb) {
+        SizeClassPool& p = pool();
+        std::lock_guard<std::mutex> lock(p.mutex);
+        for (auto& blocks : p.blocks) {
+            while (!blocks.empty() && g_live.load(std::memory_order_relaxed) + static_cast<int64_t>(p.cached) > (mb << 20)) {
+                auto header = static_cast<BlockHeader*>(blocks.back());
+                p.cached -= header->bytes;
+                free(blocks.back());
+                blocks.pop_back();
+            }
+        }
+    }
+
+    vsapi->mapSetInt(out, "mb", mb, maReplace);
+}
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <thread>
+
+#include "shared.h"
+
+// Frame threads push records onto an intrusive MPSC queue (one atomic exchange, no lock) and a writer thread owned by
+// the log drains it. Records are held back until every earlier selected frame is written, so the file is in frame
+// order whatever order the frames were requested in. Past kMaxHeldRecords the oldest held records are written anyway,
+// frames that show up after that are appended where they arrive.
+
+constexpr char kMetricLogMagic[8] = {'J', 'U', 'L', 'E', 'K', 'L', 'G', '1'};
+constexpr size_t kMaxHeldRecords = 4096;
+constexpr auto kWriterWait = std::chrono::milliseconds(20);
+
+enum class LogFormat {
+    CSV,
+    JSONL,
+    Binary,
+};
+
+struct LogRecord final {
+    std::atomic<LogRecord*> next{nullptr};
+    int frame = 0;
+    std::vector<double> scores;
+};
+
+struct MetricLog final {
+    FILE* file = nullptr;
+    LogFormat format = LogFormat::CSV;
+    std::vector<std::string> columns;
+
+    // queue: producers exchange head, the writer owns tail, which is always a consumed node
+    std::atomic<LogRecord*> head{nullptr};
+    LogRecord* tail = nullptr;
+
+    std::vector<int> order;     // selected frames, ascending
+    std::vector<bool> written;  // indexed by frame number
+    size_t next = 0;            // index in order of the next frame to write
+    std::map<int, std::vector<double>> held;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stop = false;
+    std::atomic<bool> failed{false};
+    std::thread writer;
+
+    ~MetricLog() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv.notify_one();
+        if (writer.joinable())
+            writer.join();
+
+        while (tail) {
+            LogRecord* next_record = tail->next.load(std::memory_order_acquire);
+            delete tail;
+            tail = next_record;
+        }
+        if (file)
+            fclose(file);
+    }
+};
+
+static void write_header(MetricLog& log) {
+    FILE* f = log.file;
+    if (log.format == LogFormat::CSV) {
+        fputs("frame", f);
+        for (const auto& column : log.columns)
+            fprintf(f, ",%s", column.c_str());
+        fputc('\n', f);
+    } else if (log.format == LogFormat::Binary) {
+        fwrite(kMetricLogMagic, 1, sizeof(kMetricLogMagic), f);
+        const uint32_t count = static_cast<uint32_t>(log.columns.size());
+        fwrite(&count, sizeof(count), 1, f);
+        for (const auto& column : log.columns) {
+            const uint32_t length = static_cast<uint32_t>(column.size());
+            fwrite(&length, sizeof(length), 1, f);
+            fwrite(column.data(), 1, length, f);
+        }
+    }
+}
+
+static void write_record(MetricLog& log, int frame, const std::vector<double>& scores) {
+    FILE* f = log.file;
+    log.written[frame] = true;
+
+    if (log.format == LogFormat::CSV) {
+        fprintf(f, "%d", frame);
+        for (const double v : scores)
+            fprintf(f, ",%.17g", v);
+        fputc('\n', f);
+    } else if (log.format == LogFormat::JSONL) {
+        fprintf(f, "{\"frame\": %d", frame);
+        for (size_t i{0}; i < scores.size(); i++) {
+            if (std::isfinite(scores[i]))
+                fprintf(f, ", \"%s\": %.17g", log.columns[i].c_str(), scores[i]);
+            else
+                fprintf(f, ", \"%s\": null", log.columns[i].c_str());
+        }
+        fputs("}\n", f);
+    } else {
+        const int32_t frame32 = frame;
+        fwrite(&frame32, sizeof(frame32), 1, f);
+        fwrite(scores.data(), sizeof(double), scores.size(), f);
+    }
+}
+
+static LogRecord* pop_record(MetricLog& log) noexcept {
+    LogRecord* next_record = log.tail->next.load(std::memory_order_acquire);
+    if (!next_record)
+        return nullptr;
+    delete log.tail;
+    log.tail = next_record;
+    return next_record;
+}
+
+// Writes the held records that are next in frame order, and the oldest ones when too many are held.
+static bool write_ready(MetricLog& log) {
+    bool wrote = false;
+
+    while (!log.held.empty()) {
+        while (log.next < log.order.size() && log.written[log.order[log.next]])
+            log.next++;
+
+        auto it = log.held.begin();
+        const bool in_order = log.next < log.order.size() && it->first == log.order[log.next];
+        if (!in_order && log.held.size() <= kMaxHeldRecords)
+            break;
+
+        write_record(log, it->first, it->second);
+        if (!in_order)
+            log.next = std::upper_bound(log.order.begin(), log.order.end(), it->first) - log.order.begin();
+        log.held.erase(it);
+        wrote = true;
+    }
+    return wrote;
+}
+
+static void writer_loop(MetricLog& log) {
+    bool done = false;
+    while (!done) {
+        {
+            std::unique_lock<std::mutex> lock(log.mutex);
+            log.cv.wait_for(lock, kWriterWait, [&log] { return log.stop || log.tail->next.load(std::memory_order_acquire); });
+            done = log.stop;
+        }
+
+        bool wrote = false;
+        while (LogRecord* r = pop_record(log)) {
+            if (log.written[r->frame] || log.held.count(r->frame))
+                continue;
+
+            // A frame the order already went past is written where it is.
+            const size_t pos = std::lower_bound(log.order.begin(), log.order.end(), r->frame) - log.order.begin();
+            if (pos < log.next) {
+                write_record(log, r->frame, r->scores);
+                wrote = true;
+            } else {
+                log.held.emplace(r->frame, std::move(r->scores));
+            }
+        }
+        wrote |= write_ready(log);
+
+        if (done) {
+            for (const auto& [frame, scores] : log.held)
+                write_record(log, frame, scores);
+            log.held.clear();
+            wrote = true;
+        }
+
+        if (wrote && (fflush(log.file) || ferror(log.file)))
+            log.failed = true;
+    }
+}
+
+std::shared_ptr<MetricLog> open_metric_log(const std::string& path, const std::vector<std::string>& columns, const FrameSelection& sel, int num_frames, std::string& error) {
+    auto ends_with = [&path](const char* ext) {
+        const size_t len = strlen(ext);
+        return path.size() >= len && path.compare(path.size() - len, len, ext) == 0;
+    };
+
+    auto log = std::make_shared<MetricLog>();
+    if (ends_with(".csv")) {
+        log->format = LogFormat::CSV;
+    } else if (ends_with(".jsonl")) {
+        log->format = LogFormat::JSONL;
+    } else if (ends_with(".bin")) {
+        log->format = LogFormat::Binary;
+    } else {
+        error = "log must end in .csv, .jsonl or .bin.";
+        return nullptr;
+    }
+
+    log->file = fopen(path.c_str(), log->format == LogFormat::Binary ? "wb" : "w");
+    if (!log->file) {
+        error = "failed to open log for writing.";
+        return nullptr;
+    }
+
+    log->columns = columns;
+    log->written.resize(num_frames);
+    for (int n{0}; n < num_frames; n++) {
+        if (sel.contains(n))
+            log->order.push_back(n);
+    }
+
+    write_header(*log);
+    log->tail = new LogRecord;
+    log->head = log->tail;
+    log->writer = std::thread(writer_loop, std::ref(*log));
+    return log;
+}
+
+bool metric_log_push(MetricLog& log, int frame, const double* scores) noexcept {
+    if (log.failed.load(std::memory_order_relaxed))
+        return false;
+
+    LogRecord* r = new (std::nothrow) LogRecord;
+    if (!r)
+        return false;
+    r->frame = frame;
+    try {
+        r->scores.assign(scores, scores + log.columns.size());
+    } catch (...) {
+        delete r;
+        return false;
+    }
+
+    LogRecord* prev = log.head.exchange(r, std::memory_order_acq_rel);
+    prev->next.store(r, std::memory_order_release);
+    log.cv.notify_one();
+    return true;
+}
\ No newline at end of file
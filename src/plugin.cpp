@@ -0,0 +1,16 @@
+#include "shared.h"
+
+VS_EXTERNAL_API(void)
+VapourSynthPluginInit2(VSPlugin* plugin, const VSPLUGINAPI* vspapi) {
+    vspapi->configPlugin("com.julek.plugin", "julek", "Julek filters", 4, VAPOURSYNTH_API_VERSION, 0, plugin);
+    vspapi->registerFunction("AGM", "clip:vnode;luma_scaling:float:opt;", "clip:vnode;", agmCreate, nullptr, plugin);
+    vspapi->registerFunction("AutoGain", "clip:vnode;planes:int[]:opt;", "clip:vnode;", autogainCreate, nullptr, plugin);
+    vspapi->registerFunction("Butteraugli", "reference:vnode;distorted:vnode[];distmap:int:opt;heatmap:int:opt;intensity_target:float:opt;linput:int:opt;qnorm:float:opt;threads:int:opt;strip:int:opt;blocksize:int:opt;step:int:opt;frames:int[]:opt;memo:int:opt;cache_path:data:opt;gate_psnr:float:opt;downscale:int:opt;left:int:opt;top:int:opt;width:int:opt;height:int:opt;max_inflight:int:opt;log:data:opt;", "clip:vnode;", butteraugliCreate, nullptr, plugin);
+    vspapi->registerFunction("ColorMap", "clip:vnode;type:int:opt;", "clip:vnode;", colormapCreate, nullptr, plugin);
+    vspapi->registerFunction("Metrics", "reference:vnode;distorted:vnode;metrics:data[]:opt;intensity_target:float:opt;linput:int:opt;qnorm:float:opt;simple:int:opt;", "clip:vnode;", metricsCreate, nullptr, plugin);
+    vspapi->registerFunction("MetricSummary", "clip:vnode;props:data[];path:data:opt;running:int:opt;", "clip:vnode;", metricsummaryCreate, nullptr, plugin);
+    vspapi->registerFunction("RFS", "clip_a:vnode;clip_b:vnode;frames:int[];mismatch:int:opt;", "clip:vnode;", rfsCreate, nullptr, plugin);
+    vspapi->registerFunction("SetMemoryBudget", "mb:int:opt;", "mb:int;", memorybudgetCreate, nullptr, plugin);
+    vspapi->registerFunction("SSIMULACRA", "reference:vnode;distorted:vnode[];feature:int:opt;simple:int:opt;linput:int:opt;blocksize:int:opt;step:int:opt;frames:int[]:opt;memo:int:opt;cache_path:data:opt;gate_psnr:float:opt;downscale:int:opt;left:int:opt;top:int:opt;width:int:opt;height:int:opt;max_inflight:int:opt;log:data:opt;", "clip:vnode;", ssimulacraCreate, nullptr, plugin);
+    vspapi->registerFunction("VisualizeDiffs", "clip_a:vnode;clip_b:vnode;auto_gain:int:opt;type:int:opt;", "clip:vnode;", visualizediffsCreate, nullptr, plugin);
+}
\ No newline at end of file
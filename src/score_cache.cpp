@@ -0,0 +1,342 @@
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <list>
+#include <unordered_map>
+
+#include "shared.h"
+
+// Frame hashing: every row goes through the stripe kernel (see select_hash_stripes), the words past the last
+// stripe are mixed in the same way, then the lanes are scrambled. The lanes are folded at the end.
+
+constexpr uint64_t kPrime1 = 0x9e3779b185ebca87ULL;
+constexpr uint64_t kPrime2 = 0xc2b2ae3d27d4eb4fULL;
+constexpr uint64_t kPrime3 = 0x165667b19e3779f9ULL;
+
+constexpr int kCacheShards = 16;
+constexpr size_t kCacheEntriesPerShard = 4096;
+
+static inline uint64_t read64(const uint8_t* p) noexcept {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t avalanche(uint64_t h) noexcept {
+    h ^= h >> 33;
+    h *= kPrime2;
+    h ^= h >> 29;
+    h *= kPrime3;
+    h ^= h >> 32;
+    return h;
+}
+
+static void hash_bytes(const uint8_t* data, size_t bytes, uint64_t* acc, HashStripesFunc stripes) noexcept {
+    stripes(data, bytes / 32, acc);
+
+    // The tail words continue the stripe numbering.
+    const uint64_t offset = (bytes / 32) * kHashStep;
+    size_t pos = bytes & ~size_t(31);
+    for (int lane = 0; pos + 8 <= bytes; pos += 8, lane++)
+        hash_mix_word(acc[lane], read64(data + pos), kHashSecret[lane] + offset);
+
+    if (pos < bytes) {
+        uint8_t tail[8] = {};
+        memcpy(tail, data + pos, bytes - pos);
+        hash_mix_word(acc[3], read64(tail), kHashSecret[3] + offset);
+    }
+
+    for (int lane = 0; lane < 4; lane++) {
+        acc[lane] += bytes;
+        acc[lane] ^= acc[lane] >> 47;
+        acc[lane] *= kPrime1;
+    }
+}
+
+static uint64_t fold(const uint64_t* acc) noexcept {
+    uint64_t h = kPrime3;
+    for (int lane = 0; lane < 4; lane++)
+        h = (h ^ avalanche(acc[lane])) * kPrime1;
+    return avalanche(h);
+}
+
+uint64_t frame_hash(const VSFrame* frame, const VSAPI* vsapi) noexcept {
+    static const HashStripesFunc stripes = select_hash_stripes();
+    const VSVideoFormat* fi = vsapi->getVideoFrameFormat(frame);
+
+    uint64_t acc[4] = {kPrime1, kPrime2, kPrime3, kPrime1 ^ kPrime2};
+    for (int plane = 0; plane < fi->numPlanes; plane++) {
+        const uint8_t* srcp = vsapi->getReadPtr(frame, plane);
+        const ptrdiff_t stride = vsapi->getStride(frame, plane);
+        const int width = vsapi->getFrameWidth(frame, plane);
+        const int height = vsapi->getFrameHeight(frame, plane);
+        const size_t row_bytes = static_cast<size_t>(width) * fi->bytesPerSample;
+
+        for (int y = 0; y < height; y++)
+            hash_bytes(srcp + y * stride, row_bytes, acc, stripes);
+    }
+
+    // Frames with the same pixels can still convert differently.
+    static const char* const props_used[] = {"_Matrix", "_ColorRange", "_Transfer", "_Primaries", "_ChromaLocation"};
+    const VSMap* props = vsapi->getFramePropertiesRO(frame);
+    double values[6];
+    values[0] = vsapi->getFrameWidth(frame, 0) * 65536.0 + vsapi->getFrameHeight(frame, 0);
+    for (int i = 0; i < 5; i++) {
+        int err{0};
+        const int64_t v = vsapi->mapGetInt(props, props_used[i], 0, &err);
+        values[i + 1] = err ? -1.0 : static_cast<double>(v);
+    }
+
+    return fold(acc) ^ hash_values(values, 6);
+}
+
+bool frames_equal(const VSFrame* a, const VSFrame* b, const VSAPI* vsapi) noexcept {
+    const VSVideoFormat* fi = vsapi->getVideoFrameFormat(a);
+
+    for (int plane = 0; plane < fi->numPlanes; plane++) {
+        const uint8_t* ap = vsapi->getReadPtr(a, plane);
+        const uint8_t* bp = vsapi->getReadPtr(b, plane);
+        const ptrdiff_t a_stride = vsapi->getStride(a, plane);
+        const ptrdiff_t b_stride = vsapi->getStride(b, plane);
+        const size_t row_bytes = static_cast<size_t>(vsapi->getFrameWidth(a, plane)) * fi->bytesPerSample;
+
+        for (int y = 0; y < vsapi->getFrameHeight(a, plane); y++) {
+            if (memcmp(ap + y * a_stride, bp + y * b_stride, row_bytes))
+                return false;
+        }
+    }
+    return true;
+}
+
+uint64_t hash_values(const double* values, int count) noexcept {
+    uint64_t acc[4] = {kPrime2, kPrime3, kPrime1, kPrime2 ^ kPrime3};
+    hash_bytes(reinterpret_cast<const uint8_t*>(values), count * sizeof(double), acc, hash_stripes_c);
+    return fold(acc);
+}
+
+struct ScoreKeyHash final {
+    size_t operator()(const ScoreKey& key) const noexcept {
+        return static_cast<size_t>(key.ref ^ (key.dist * kPrime1) ^ (key.params * kPrime2));
+    }
+};
+
+struct ScoreKeyEqual final {
+    bool operator()(const ScoreKey& a, const ScoreKey& b) const noexcept {
+        return a.ref == b.ref && a.dist == b.dist && a.params == b.params;
+    }
+};
+
+struct CacheEntry final {
+    ScoreKey key;
+    std::array<double, kMaxCachedScores> scores;
+};
+
+struct CacheShard final {
+    std::mutex mutex;
+    std::list<CacheEntry> lru;  // most recently used first
+    std::unordered_map<ScoreKey, std::list<CacheEntry>::iterator, ScoreKeyHash, ScoreKeyEqual> index;
+};
+
+static CacheShard& shard(const ScoreKey& key) noexcept {
+    static CacheShard shards[kCacheShards];
+    return shards[(ScoreKeyHash()(key) >> 32) % kCacheShards];
+}
+
+bool score_cache_lookup(const ScoreKey& key, double* scores, int count) noexcept {
+    CacheShard& s = shard(key);
+    std::lock_guard<std::mutex> lock(s.mutex);
+
+    auto it = s.index.find(key);
+    if (it == s.index.end())
+        return false;
+
+    s.lru.splice(s.lru.begin(), s.lru, it->second);
+    std::copy_n(it->second->scores.begin(), count, scores);
+    return true;
+}
+
+void score_cache_insert(const ScoreKey& key, const double* scores, int count) noexcept {
+    CacheShard& s = shard(key);
+    std::lock_guard<std::mutex> lock(s.mutex);
+
+    auto it = s.index.find(key);
+    if (it != s.index.end()) {
+        s.lru.splice(s.lru.begin(), s.lru, it->second);
+        return;
+    }
+
+    try {
+        if (s.lru.size() >= kCacheEntriesPerShard) {
+            s.index.erase(s.lru.back().key);
+            s.lru.pop_back();
+        }
+
+        CacheEntry entry{key, {}};
+        std::copy_n(scores, count, entry.scores.begin());
+        s.lru.push_front(entry);
+        s.index.emplace(key, s.lru.begin());
+    } catch (...) {
+        // A score that doesn't make it into the cache is simply computed again.
+    }
+}
+
+// Score file layout: an 8 byte magic followed by fixed size records. Records that fail their checksum are skipped
+// on load and the file is cut after the last valid one, so a partial record left by a crash or a failed write
+// doesn't shift the records appended after it.
+
+constexpr char kScoreFileMagic[8] = {'J', 'U', 'L', 'E', 'K', 'S', 'C', '1'};
+
+struct ScoreRecord final {
+    ScoreKey key;
+    uint64_t count;
+    double scores[kMaxCachedScores];
+    uint64_t check;
+};
+
+static uint64_t record_check(const ScoreRecord& r) noexcept {
+    uint64_t acc[4] = {kPrime1, kPrime2, kPrime3, kPrime1 ^ kPrime3};
+    hash_bytes(reinterpret_cast<const uint8_t*>(&r), offsetof(ScoreRecord, check), acc, hash_stripes_c);
+    return fold(acc);
+}
+
+struct ScoreFile final {
+    std::string path;
+    std::mutex mutex;
+    FILE* file = nullptr;
+    std::unordered_map<ScoreKey, std::array<double, kMaxCachedScores>, ScoreKeyHash, ScoreKeyEqual> scores;
+    std::atomic<int64_t> hits{0};
+    std::atomic<int64_t> misses{0};
+    bool write_failed = false;  // nothing more is appended after a failed write
+
+    ~ScoreFile() {
+        if (file)
+            fclose(file);
+    }
+};
+
+// valid_end is where the next record goes, 0 when the magic has to be written first.
+static bool load_score_file(ScoreFile& f, uint64_t& valid_end, std::string& error) {
+    valid_end = 0;
+    FILE* in = fopen(f.path.c_str(), "rb");
+    if (!in)
+        return true;  // created on first write
+
+    char magic[8];
+    const size_t header = fread(magic, 1, sizeof(magic), in);
+    if (memcmp(magic, kScoreFileMagic, header)) {
+        fclose(in);
+        error = "cache_path is not a score cache file.";
+        return false;
+    }
+
+    // A torn magic is dropped too, open_score_file writes it again.
+    valid_end = (header == sizeof(magic)) ? sizeof(magic) : 0;
+    uint64_t pos = valid_end;
+    ScoreRecord r;
+    while (valid_end && fread(&r, sizeof(r), 1, in) == 1) {
+        pos += sizeof(r);
+        if (r.count > kMaxCachedScores || r.check != record_check(r))
+            continue;
+        std::array<double, kMaxCachedScores> values{};
+        std::copy_n(r.scores, r.count, values.begin());
+        f.scores[r.key] = values;
+        valid_end = pos;
+    }
+    fclose(in);
+
+    std::error_code ec;
+    const uint64_t size = std::filesystem::file_size(f.path, ec);
+    if (!ec && size > valid_end)
+        std::filesystem::resize_file(f.path, valid_end, ec);
+    if (ec) {
+        error = "failed to truncate cache_path to its last whole record.";
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<ScoreFile> open_score_file(const std::string& path, std::string& error) {
+    static std::mutex registry_mutex;
+    static std::unordered_map<std::string, std::weak_ptr<ScoreFile>> registry;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    if (auto existing = registry[path].lock())
+        return existing;
+
+    auto f = std::make_shared<ScoreFile>();
+    f->path = path;
+    uint64_t valid_end;
+    if (!load_score_file(*f, valid_end, error))
+        return nullptr;
+
+    f->file = fopen(path.c_str(), "ab");
+    if (!f->file) {
+        error = "failed to open cache_path for writing.";
+        return nullptr;
+    }
+
+    // The position of a stream opened for appending is implementation-defined until the first write.
+    if (!valid_end &&
+        (fwrite(kScoreFileMagic, 1, sizeof(kScoreFileMagic), f->file) != sizeof(kScoreFileMagic) || fflush(f->file))) {
+        error = "failed to write cache_path.";
+        return nullptr;
+    }
+
+    registry[path] = f;
+    return f;
+}
+
+bool score_file_lookup(ScoreFile& file, const ScoreKey& key, double* scores, int count) noexcept {
+    std::lock_guard<std::mutex> lock(file.mutex);
+
+    auto it = file.scores.find(key);
+    if (it == file.scores.end()) {
+        file.misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::copy_n(it->second.begin(), count, scores);
+    file.hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void score_file_insert(ScoreFile& file, const ScoreKey& key, const double* scores, int count) noexcept {
+    ScoreRecord r{};
+    r.key = key;
+    r.count = count;
+    std::copy_n(scores, count, r.scores);
+    r.check = record_check(r);
+
+    std::lock_guard<std::mutex> lock(file.mutex);
+    if (file.write_failed)
+        return;
+    try {
+        auto [it, inserted] = file.scores.emplace(key, std::array<double, kMaxCachedScores>{});
+        if (!inserted)
+            return;
+        std::copy_n(scores, count, it->second.begin());
+    } catch (...) {
+        return;
+    }
+
+    // One record per flush, so processes appending to the same file don't interleave inside a record. After a
+    // failed write the file may end in a partial record, the next open cuts it off.
+    if (fwrite(&r, sizeof(r), 1, file.file) != 1 || fflush(file.file))
+        file.write_failed = true;
+}
+
+void set_score_file_props(VSMap* props, const char* prefix, ScoreFile& file, const VSAPI* vsapi) noexcept {
+    const std::string p = prefix;
+    int64_t entries;
+    bool write_failed;
+    {
+        std::lock_guard<std::mutex> lock(file.mutex);
+        entries = static_cast<int64_t>(file.scores.size());
+        write_failed = file.write_failed;
+    }
+
+    vsapi->mapSetInt(props, (p + "_DiskCacheHits").c_str(), file.hits.load(std::memory_order_relaxed), maReplace);
+    vsapi->mapSetInt(props, (p + "_DiskCacheMisses").c_str(), file.misses.load(std::memory_order_relaxed), maReplace);
+    vsapi->mapSetInt(props, (p + "_DiskCacheEntries").c_str(), entries, maReplace);
+    vsapi->mapSetInt(props, (p + "_DiskCacheWriteFailed").c_str(), write_failed, maReplace);
+}
\ No newline at end of file
@@ -1,103 +1,578 @@
 #include "shared.h"
 
-VS_EXTERNAL_API(void)
-VapourSynthPluginInit2(VSPlugin* plugin, const VSPLUGINAPI* vspapi) {
-    vspapi->configPlugin("com.julek.plugin", "julek", "Julek filters", 4, VAPOURSYNTH_API_VERSION, 0, plugin);
-    vspapi->registerFunction("AGM", "clip:vnode;luma_scaling:float:opt;", "clip:vnode;", agmCreate, nullptr, plugin);
-    vspapi->registerFunction("AutoGain", "clip:vnode;planes:int[]:opt;", "clip:vnode;", autogainCreate, nullptr, plugin);
-    vspapi->registerFunction("Butteraugli", "reference:vnode;distorted:vnode;distmap:int:opt;heatmap:int:opt;intensity_target:float:opt;linput:int:opt;qnorm:float:opt;", "clip:vnode;", butteraugliCreate, nullptr, plugin);
-    vspapi->registerFunction("ColorMap", "clip:vnode;type:int:opt;", "clip:vnode;", colormapCreate, nullptr, plugin);
-    vspapi->registerFunction("RFS", "clip_a:vnode;clip_b:vnode;frames:int[];mismatch:int:opt;", "clip:vnode;", rfsCreate, nullptr, plugin);
-    vspapi->registerFunction("SSIMULACRA", "reference:vnode;distorted:vnode;feature:int:opt;simple:int:opt;", "clip:vnode;", ssimulacraCreate, nullptr, plugin);
-    vspapi->registerFunction("VisualizeDiffs", "clip_a:vnode;clip_b:vnode;auto_gain:int:opt;type:int:opt;", "clip:vnode;", visualizediffsCreate, nullptr, plugin);
+PlaneView3 image_view(const jxl::Image3F& img) noexcept {
+    PlaneView3 view;
+    for (int i = 0; i < 3; ++i) {
+        view.ptr[i] = img.ConstPlaneRow(i, 0);
+        view.stride[i] = img.PixelsPerRow();
+    }
+    view.xsize = img.xsize();
+    view.ysize = img.ysize();
+    return view;
 }
 
-static void* jpegxl_alloc(void* opaque, size_t size) {
-    return malloc(size);
+PlaneView3 frame_view(const VSFrame* src, const VSAPI* vsapi) noexcept {
+    PlaneView3 view;
+    for (int i = 0; i < 3; ++i) {
+        view.ptr[i] = reinterpret_cast<const float*>(vsapi->getReadPtr(src, i));
+        view.stride[i] = vsapi->getStride(src, i) / sizeof(float);
+    }
+    view.xsize = vsapi->getFrameWidth(src, 0);
+    view.ysize = vsapi->getFrameHeight(src, 0);
+    return view;
 }
 
-static void jpegxl_free(void* opaque, void* address) {
-    free(address);
+PlaneView3 frame_view(const VSFrame* src, int left, int top, int width, int height, const VSAPI* vsapi) noexcept {
+    PlaneView3 view = frame_view(src, vsapi);
+    for (int i = 0; i < 3; ++i)
+        view.ptr[i] += top * view.stride[i] + left;
+    view.xsize = width;
+    view.ysize = height;
+    return view;
 }
 
-JxlMemoryManager* get_memory_manager() {
-    static JxlMemoryManager mm = {
-        nullptr,
-        jpegxl_alloc,
-        jpegxl_free};
-    return &mm;
+static size_t image_bytes(const jxl::ImageF& img) noexcept {
+    return img.bytes_per_row() * img.ysize();
 }
 
-template <typename pixel_t, bool linput>
-void fill_image(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept {
-    auto tmp1_res = jxl::Image3F::Create(get_memory_manager(), width, height);
-    auto tmp2_res = jxl::Image3F::Create(get_memory_manager(), width, height);
-    if (!tmp1_res.ok() || !tmp2_res.ok()) return;
-    jxl::Image3F tmp1 = std::move(tmp1_res).value_();
-    jxl::Image3F tmp2 = std::move(tmp2_res).value_();
+static size_t image_bytes(const jxl::Image3F& img) noexcept {
+    return image_bytes(img.Plane(0)) + image_bytes(img.Plane(1)) + image_bytes(img.Plane(2));
+}
 
-    float scale = 1.0f / std::numeric_limits<pixel_t>::max();
+template <typename T>
+static size_t vector_bytes(const std::vector<T>& v) noexcept {
+    return v.capacity() * sizeof(T);
+}
 
-    for (int i = 0; i < 3; ++i) {
-        auto srcp1{reinterpret_cast<const pixel_t*>(vsapi->getReadPtr(src1, i))};
-        auto srcp2{reinterpret_cast<const pixel_t*>(vsapi->getReadPtr(src2, i))};
-        const ptrdiff_t stride1 = vsapi->getStride(src1, i) / sizeof(pixel_t);
-        const ptrdiff_t stride2 = vsapi->getStride(src2, i) / sizeof(pixel_t);
-
-        for (int y = 0; y < height; ++y) {
-            float* VS_RESTRICT row1 = tmp1.PlaneRow(i, y);
-            float* VS_RESTRICT row2 = tmp2.PlaneRow(i, y);
-
-            for (int x = 0; x < width; ++x) {
-                row1[x] = srcp1[x] * scale;
-                row2[x] = srcp2[x] * scale;
+size_t FillScratch::bytes() const noexcept {
+    return vector_bytes(x0) + vector_bytes(x1) + vector_bytes(wx) + vector_bytes(yrow) + vector_bytes(urow) + vector_bytes(vrow) +
+           vector_bytes(crow0) + vector_bytes(crow1) + vector_bytes(ctmp);
+}
+
+void FrameScratch::reset(int num_dist) {
+    src2.assign(num_dist, nullptr);
+    dist_hash.assign(num_dist, 0);
+    psnr.assign(num_dist, std::numeric_limits<double>::quiet_NaN());
+    gated.assign(num_dist, 0);
+    pending.clear();
+    norms.assign(num_dist, ButteraugliNorms{});
+    ssim.assign(num_dist, {});
+    acc.assign(num_dist, NormAccumulator{});
+    // blocks keep their grids, BlockStats::init reuses them.
+    log_row.clear();
+}
+
+size_t FrameScratch::bytes() const noexcept {
+    size_t total = vector_bytes(src2) + vector_bytes(dist_hash) + vector_bytes(psnr) + vector_bytes(gated) +
+                   vector_bytes(pending) + vector_bytes(norms) + vector_bytes(ssim) + vector_bytes(acc) + vector_bytes(blocks) + vector_bytes(log_row);
+    for (const auto& b : blocks)
+        total += vector_bytes(b.max) + vector_bytes(b.sum);
+    return total;
+}
+
+static size_t band_bytes(const ButteraugliBand& band) noexcept {
+    return image_bytes(band.ref) + image_bytes(band.dist) + image_bytes(band.diff_map);
+}
+
+jxl::Status MetricWorkspace::ensure_images(size_t width, size_t height) {
+    JXL_RETURN_IF_ERROR(ensure_size(scratch.memory_manager, ref, width, height));
+    return ensure_size(scratch.memory_manager, dist, width, height);
+}
+
+void MetricWorkspace::trim() noexcept {
+    ref = jxl::Image3F();
+    dist = jxl::Image3F();
+    diff_map = jxl::ImageF();
+    ref_pyramid.scales.clear();
+    scratch.scales.clear();
+    scratch.blur_temp = jxl::ImageF();
+    scratch.blur_w = scratch.blur_h = 0;
+    bands.clear();
+    strip = ButteraugliBand{};
+    fill.band = jxl::Image3F();
+}
+
+size_t MetricWorkspace::pooled_bytes() const noexcept {
+    size_t total = image_bytes(ref) + image_bytes(dist) + image_bytes(diff_map) + image_bytes(scratch.blur_temp) + band_bytes(strip) +
+                   image_bytes(fill.band);
+
+    for (const auto& s : ref_pyramid.scales)
+        total += image_bytes(s.img) + image_bytes(s.mu) + image_bytes(s.sigma_sq);
+    for (const auto& s : scratch.scales)
+        total += image_bytes(s.downscaled) + image_bytes(s.img2) + image_bytes(s.mul) + image_bytes(s.sigma2_sq) + image_bytes(s.sigma12) + image_bytes(s.mu2);
+    for (const auto& band : bands)
+        total += band_bytes(band);
+    return total;
+}
+
+size_t MetricWorkspace::bytes() const noexcept {
+    return pooled_bytes() + fill.bytes() + frame.bytes() + vector_bytes(bands);
+}
+
+jxl::Status ensure_size(JxlMemoryManager* mm, jxl::Image3F& img, size_t width, size_t height) {
+    if (img.xsize() != width || img.ysize() != height) {
+        JXL_ASSIGN_OR_RETURN(img, jxl::Image3F::Create(mm, width, height));
+    }
+    return true;
+}
+
+MetricWorkspace* WorkspacePool::acquire(size_t width, size_t height) noexcept {
+    MetricWorkspace* ws = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!idle.empty()) {
+            ws = idle.back();
+            idle.pop_back();
+            // The workspace is in use again, its memory counts against the budget from now on.
+            memory_idle_add(-static_cast<int64_t>(ws->idle_credit));
+            ws->idle_credit = 0;
+        } else {
+            workspaces.push_back(std::make_unique<MetricWorkspace>());
+            ws = workspaces.back().get();
+            ws->scratch.memory_manager = memory_manager;
+            ws->fill.memory_manager = memory_manager;
+        }
+    }
+
+    // Only the first frame (or a frame size change) allocates, later frames find the images at the right size.
+    if (width && height && !ws->ensure_images(width, height)) {
+        release(ws);
+        return nullptr;
+    }
+    return ws;
+}
+
+void WorkspacePool::release(MetricWorkspace* ws) noexcept {
+    // Only the releasing thread touches ws, the other workspaces may still be in use and are counted by their last size.
+    const size_t bytes = ws->bytes();
+    if (memory_over_budget())
+        ws->trim();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    total = total - ws->accounted + bytes;
+    ws->accounted = bytes;
+    peak = std::max(peak, total);
+    ws->idle_credit = ws->pooled_bytes();
+    memory_idle_add(static_cast<int64_t>(ws->idle_credit));
+    idle.push_back(ws);
+}
+
+WorkspacePool::~WorkspacePool() {
+    for (MetricWorkspace* ws : idle)
+        memory_idle_add(-static_cast<int64_t>(ws->idle_credit));
+}
+
+void WorkspacePool::set_memory_manager(JxlMemoryManager* mm) noexcept {
+    memory_manager = mm;
+}
+
+size_t WorkspacePool::high_water() noexcept {
+    std::lock_guard<std::mutex> lock(mutex);
+    return peak;
+}
+
+bool read_metric_clips(const VSMap* in, VSNode*& node, std::vector<VSNode*>& node2, std::string& error, VSCore* core, const VSAPI* vsapi) noexcept {
+    node = nullptr;
+    node2.clear();
+
+    const int num_dist = vsapi->mapNumElements(in, "distorted");
+    if (num_dist < 1) {
+        error = "distorted must contain at least one clip.";
+        return false;
+    }
+
+    node = toMetricInput(vsapi->mapGetNode(in, "reference", 0, nullptr), core, vsapi);
+    bool converted = !!node;
+    for (int i = 0; i < num_dist; i++) {
+        VSNode* dist = toMetricInput(vsapi->mapGetNode(in, "distorted", i, nullptr), core, vsapi);
+        converted = converted && dist;
+        if (dist)
+            node2.push_back(dist);
+    }
+
+    if (converted) {
+        const VSVideoInfo* vi = vsapi->getVideoInfo(node);
+        for (auto dist : node2) {
+            if (!vsh::isSameVideoInfo(vsapi->getVideoInfo(dist), vi)) {
+                error = "all clips must have the same format and dimensions.";
+                break;
             }
+        }
+        if (error.empty())
+            return true;
+    } else {
+        error = "Failed to convert input";
+    }
+
+    if (node) vsapi->freeNode(node);
+    for (auto dist : node2)
+        vsapi->freeNode(dist);
+    node = nullptr;
+    node2.clear();
+    return false;
+}
+
+struct MetricLane final {
+    std::shared_ptr<void> data;  // instance data of the filter, shared by every lane
+    VSFilterGetFrame get_frame;
+    int lane, lanes;
+    int frames;  // of the full clip
+};
+
+static const VSFrame* VS_CC laneGetFrame(int n, int activationReason, void* instanceData, void** frameData, VSFrameContext* frameCtx, VSCore* core, const VSAPI* vsapi) {
+    auto l{static_cast<MetricLane*>(instanceData)};
+    // The last lanes run past the end when lanes doesn't divide the length, std.Trim drops those frames.
+    const int frame = std::min(l->lane + l->lanes * n, l->frames - 1);
+    return l->get_frame(frame, activationReason, l->data.get(), frameData, frameCtx, core, vsapi);
+}
+
+static void VS_CC laneFree(void* instanceData, VSCore* core, const VSAPI* vsapi) {
+    delete static_cast<MetricLane*>(instanceData);
+}
+
+bool create_metric_lanes(VSMap* out, const char* name, const VSVideoInfo* vi, VSFilterGetFrame get_frame, std::shared_ptr<void> data, int lanes, const std::vector<VSFilterDependency>& deps, std::string& error, VSCore* core, const VSAPI* vsapi) noexcept {
+    lanes = std::clamp(lanes, 1, vi->numFrames);
+    VSVideoInfo lane_vi = *vi;
+    lane_vi.numFrames = (vi->numFrames + lanes - 1) / lanes;
+
+    VSMap* args = vsapi->createMap();
+    for (int i = 0; i < lanes; i++) {
+        VSNode* lane = vsapi->createVideoFilter2(name, &lane_vi, laneGetFrame, laneFree, fmParallelRequests, deps.data(), static_cast<int>(deps.size()),
+                                                 new MetricLane{data, get_frame, i, lanes, vi->numFrames}, core);
+        vsapi->mapConsumeNode(args, "clips", lane, maAppend);
+    }
+    data.reset();
+    vsapi->mapSetInt(args, "modify_duration", 0, maReplace);
+
+    VSPlugin* stdplugin = vsapi->getPluginByID(VSH_STD_PLUGIN_ID, core);
+    VSMap* ret = vsapi->invoke(stdplugin, "Interleave", args);
+    vsapi->freeMap(args);
+    if (vsapi->mapGetError(ret)) {
+        error = vsapi->mapGetError(ret);
+        vsapi->freeMap(ret);
+        return false;
+    }
+
+    args = vsapi->createMap();
+    vsapi->mapConsumeNode(args, "clip", vsapi->mapGetNode(ret, "clip", 0, nullptr), maReplace);
+    vsapi->mapSetInt(args, "length", vi->numFrames, maReplace);
+    vsapi->freeMap(ret);
+    ret = vsapi->invoke(stdplugin, "Trim", args);
+    vsapi->freeMap(args);
+    if (vsapi->mapGetError(ret)) {
+        error = vsapi->mapGetError(ret);
+        vsapi->freeMap(ret);
+        return false;
+    }
+
+    vsapi->mapConsumeNode(out, "clip", vsapi->mapGetNode(ret, "clip", 0, nullptr), maAppend);
+    vsapi->freeMap(ret);
+    return true;
+}
+
+constexpr int64_t kInflightMemory = int64_t(3) << 30;
+constexpr int64_t kInflightBytesPerPixel = 160;  // images of one frame of Butteraugli or SSIMULACRA2
+
+int default_max_inflight(int width, int height, VSCore* core, const VSAPI* vsapi) noexcept {
+    VSCoreInfo info;
+    vsapi->getCoreInfo(core, &info);
+
+    const int64_t frames = std::max<int64_t>(kInflightMemory / (static_cast<int64_t>(width) * height * kInflightBytesPerPixel), 1);
+    return (frames >= info.numThreads) ? 0 : static_cast<int>(frames);
+}
 
-            srcp1 += stride1;
-            srcp2 += stride2;
+bool read_metric_region(const VSMap* in, const VSVideoInfo* vi, MetricRegion& region, std::string& error, const VSAPI* vsapi) noexcept {
+    int err{0};
+
+    region.left = vsapi->mapGetIntSaturated(in, "left", 0, &err);
+    if (err)
+        region.left = 0;
+
+    region.top = vsapi->mapGetIntSaturated(in, "top", 0, &err);
+    if (err)
+        region.top = 0;
+
+    region.width = vsapi->mapGetIntSaturated(in, "width", 0, &err);
+    if (err)
+        region.width = vi->width - region.left;
+
+    region.height = vsapi->mapGetIntSaturated(in, "height", 0, &err);
+    if (err)
+        region.height = vi->height - region.top;
+
+    if (region.left < 0 || region.top < 0 || region.width <= 0 || region.height <= 0 || region.left + region.width > vi->width || region.top + region.height > vi->height) {
+        error = "the left/top/width/height window must lie inside the frame.";
+        return false;
+    }
+    return true;
+}
+
+bool read_frame_selection(const VSMap* in, int num_frames, FrameSelection& sel, std::string& error, const VSAPI* vsapi) noexcept {
+    int err{0};
+    const int num_listed = vsapi->mapNumElements(in, "frames");
+
+    sel.step = vsapi->mapGetIntSaturated(in, "step", 0, &err);
+    if (err)
+        sel.step = (num_listed > 0) ? 0 : 1;
+
+    if (sel.step < 0) {
+        error = "step must be 0 (only frames) or greater.";
+        return false;
+    }
+
+    if (!sel.step && num_listed <= 0) {
+        error = "step=0 requires frames.";
+        return false;
+    }
+
+    sel.frames.clear();
+    for (int i = 0; i < num_listed; i++) {
+        const int64_t n = vsapi->mapGetInt(in, "frames", i, nullptr);
+        if (n < 0 || n >= num_frames) {
+            error = "frames must be in the range of the clip.";
+            return false;
         }
+        if (sel.frames.empty())
+            sel.frames.resize(num_frames);
+        sel.frames[n] = true;
     }
+    return true;
+}
+
+double frame_psnr(const VSFrame* a, const VSFrame* b, const MetricRegion& region, SSERowFunc sse_row, const VSAPI* vsapi) noexcept {
+    const VSVideoFormat* fi = vsapi->getVideoFrameFormat(a);
+    const float scale = (fi->sampleType == stFloat) ? 1.0f : 1.0f / ((1 << fi->bitsPerSample) - 1);
+    double sse = 0.0;
+    double samples = 0.0;
+
+    for (int plane = 0; plane < fi->numPlanes; plane++) {
+        const int ss_w = plane ? fi->subSamplingW : 0;
+        const int ss_h = plane ? fi->subSamplingH : 0;
+        const int x0 = region.left >> ss_w;
+        const int y0 = region.top >> ss_h;
+        const int x1 = (region.left + region.width + (1 << ss_w) - 1) >> ss_w;
+        const int y1 = (region.top + region.height + (1 << ss_h) - 1) >> ss_h;
+
+        const ptrdiff_t a_stride = vsapi->getStride(a, plane);
+        const ptrdiff_t b_stride = vsapi->getStride(b, plane);
+        const uint8_t* ap = vsapi->getReadPtr(a, plane) + y0 * a_stride + x0 * fi->bytesPerSample;
+        const uint8_t* bp = vsapi->getReadPtr(b, plane) + y0 * b_stride + x0 * fi->bytesPerSample;
 
-    if (!ref.SetFromImage(std::move(tmp1), (linput) ? jxl::ColorEncoding::LinearSRGB(false) : jxl::ColorEncoding::SRGB(false)) ||
-        !dist.SetFromImage(std::move(tmp2), (linput) ? jxl::ColorEncoding::LinearSRGB(false) : jxl::ColorEncoding::SRGB(false))) {
-        return;
+        for (int y = 0; y < y1 - y0; y++)
+            sse += sse_row(ap + y * a_stride, bp + y * b_stride, x1 - x0, scale);
+        samples += static_cast<double>(x1 - x0) * (y1 - y0);
     }
+
+    if (sse <= 0.0)
+        return std::numeric_limits<double>::infinity();
+    return 10.0 * std::log10(samples / sse);
+}
+
+constexpr int kWorstBlocks = 16;
+
+void BlockStats::init(int block, int w, int h) {
+    blocksize = block;
+    width = w;
+    height = h;
+    cols = (w + block - 1) / block;
+    rows = (h + block - 1) / block;
+    max.assign(static_cast<size_t>(cols) * rows, 0.0f);
+    sum.assign(static_cast<size_t>(cols) * rows, 0.0);
+}
+
+void BlockStats::add_rows(const jxl::ImageF& map, int map_top, int y0, int y1) noexcept {
+    for (int y = y0; y < y1; y++) {
+        const float* row = map.ConstRow(y - map_top);
+        float* VS_RESTRICT bmax = max.data() + static_cast<size_t>(y / blocksize) * cols;
+        double* VS_RESTRICT bsum = sum.data() + static_cast<size_t>(y / blocksize) * cols;
+
+        for (int bx = 0; bx < cols; bx++) {
+            const int x1 = std::min((bx + 1) * blocksize, width);
+            float m = bmax[bx];
+            float acc = 0.0f;
+            for (int x = bx * blocksize; x < x1; x++) {
+                m = std::max(m, row[x]);
+                acc += row[x];
+            }
+            bmax[bx] = m;
+            bsum[bx] += acc;
+        }
+    }
+}
+
+void set_block_props(VSMap* props, const char* prefix, const std::string& suffix, const BlockStats& stats, const VSAPI* vsapi) noexcept {
+    const std::string p = prefix;
+    const int num_blocks = stats.cols * stats.rows;
+
+    std::vector<double> values(num_blocks);
+    for (int i = 0; i < num_blocks; i++)
+        values[i] = stats.max[i];
+    vsapi->mapSetFloatArray(props, (p + "_BlockMax" + suffix).c_str(), values.data(), num_blocks);
+
+    for (int by = 0; by < stats.rows; by++) {
+        const int bh = std::min(stats.blocksize, stats.height - by * stats.blocksize);
+        for (int bx = 0; bx < stats.cols; bx++) {
+            const int bw = std::min(stats.blocksize, stats.width - bx * stats.blocksize);
+            values[by * stats.cols + bx] = stats.sum[by * stats.cols + bx] / (static_cast<double>(bw) * bh);
+        }
+    }
+    vsapi->mapSetFloatArray(props, (p + "_BlockMean" + suffix).c_str(), values.data(), num_blocks);
+
+    vsapi->mapSetInt(props, (p + "_BlockCols" + suffix).c_str(), stats.cols, maReplace);
+    vsapi->mapSetInt(props, (p + "_BlockRows" + suffix).c_str(), stats.rows, maReplace);
+
+    std::vector<int> order(num_blocks);
+    for (int i = 0; i < num_blocks; i++)
+        order[i] = i;
+    const int k = std::min(kWorstBlocks, num_blocks);
+    std::partial_sort(order.begin(), order.begin() + k, order.end(), [&](int a, int b) { return stats.max[a] > stats.max[b]; });
+
+    std::vector<int64_t> worst(k * 2);
+    for (int i = 0; i < k; i++) {
+        worst[i * 2] = order[i] % stats.cols;
+        worst[i * 2 + 1] = order[i] / stats.cols;
+    }
+    vsapi->mapSetIntArray(props, (p + "_WorstBlocks" + suffix).c_str(), worst.data(), k * 2);
+}
+
+static const char* const kHDRTransferError = "PQ and HLG (_Transfer 16 and 18) aren't supported, convert the clips to SDR first.";
+
+// The rows are converted in place from the frame's planes, starting at the (left, top) corner.
+template <typename pixel_t, bool linput>
+bool fill_image(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept {
+    if (!linput) {
+        // toRGBS keeps the _Transfer of the source, the gamma of RGB input is read as sRGB.
+        int err;
+        const int64_t transfer = vsapi->mapGetInt(vsapi->getFramePropertiesRO(src), "_Transfer", 0, &err);
+        if (!err && (transfer == VSC_TRANSFER_ST2084 || transfer == VSC_TRANSFER_ARIB_B67)) {
+            scratch.error = kHDRTransferError;
+            return false;
+        }
+    }
+
+    const uint8_t* srcp[3];
+    ptrdiff_t src_stride[3], dst_stride[3];
+    float* dstp[3];
+
+    for (int i = 0; i < 3; ++i) {
+        src_stride[i] = vsapi->getStride(src, i);
+        srcp[i] = vsapi->getReadPtr(src, i) + top * src_stride[i] + left * sizeof(pixel_t);
+        dstp[i] = img.PlaneRow(i, 0);
+        dst_stride[i] = img.PixelsPerRow() * sizeof(float);
+    }
+
+    rgb_to_linear<pixel_t, linput>(srcp, src_stride, vsapi->getVideoFrameFormat(src)->bitsPerSample, dstp, dst_stride, width, height);
+    return true;
 }
 
 template <bool linput>
-void fill_imageF(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept {
-    auto tmp1_res = jxl::Image3F::Create(get_memory_manager(), width, height);
-    auto tmp2_res = jxl::Image3F::Create(get_memory_manager(), width, height);
-    if (!tmp1_res.ok() || !tmp2_res.ok()) return;
-    jxl::Image3F tmp1 = std::move(tmp1_res).value_();
-    jxl::Image3F tmp2 = std::move(tmp2_res).value_();
+bool fill_imageF(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept {
+    return fill_image<float, linput>(img, src, left, top, width, height, scratch, vsapi);
+}
+
+template <typename pixel_t>
+bool fill_yuv(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept {
+    const int frame_height = vsapi->getFrameHeight(src, 0);
+    YUVConversion conv;
+    if (!yuv_conversion(conv, vsapi->getVideoFrameFormat(src), vsapi->getFramePropertiesRO(src), frame_height, vsapi)) {
+        scratch.error = kHDRTransferError;
+        return false;
+    }
 
+    const uint8_t* srcp[3];
+    ptrdiff_t stride[3];
     for (int i = 0; i < 3; ++i) {
-        const float* srcp1{reinterpret_cast<const float*>(vsapi->getReadPtr(src1, i))};
-        const float* srcp2{reinterpret_cast<const float*>(vsapi->getReadPtr(src2, i))};
-        const ptrdiff_t stride1 = vsapi->getStride(src1, i) / sizeof(float);
-        const ptrdiff_t stride2 = vsapi->getStride(src2, i) / sizeof(float);
+        srcp[i] = vsapi->getReadPtr(src, i);
+        stride[i] = vsapi->getStride(src, i);
+    }
+
+    yuv_to_linear<pixel_t>(img, srcp, stride, left, top, width, height, vsapi->getFrameWidth(src, 0), frame_height, conv, scratch);
+    return true;
+}
 
-        for (int y = 0; y < height; ++y) {
-            memcpy(tmp1.PlaneRow(i, y), srcp1, width * sizeof(float));
-            memcpy(tmp2.PlaneRow(i, y), srcp2, width * sizeof(float));
+// Area average of factor x factor blocks in linear light. width and height are in output pixels, the source is
+// converted a few rows at a time into scratch.band, so the full resolution image is never built.
+template <FillFunc base, int factor>
+bool fill_downscaled(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept {
+    constexpr int kBandRows = 8;  // output rows per band
+    constexpr float kNorm = 1.0f / (factor * factor);
+    jxl::Image3F& band = scratch.band;
+
+    if (!ensure_size(scratch.memory_manager, band, width * factor, kBandRows * factor)) {
+        scratch.error = "Failed to allocate image";
+        return false;
+    }
 
-            srcp1 += stride1;
-            srcp2 += stride2;
+    for (int y0 = 0; y0 < height; y0 += kBandRows) {
+        const int rows = std::min(kBandRows, height - y0);
+        if (!base(band, src, left, top + y0 * factor, width * factor, rows * factor, scratch, vsapi))
+            return false;
+
+        for (int c = 0; c < 3; ++c) {
+            for (int y = 0; y < rows; ++y) {
+                float* VS_RESTRICT dstp = img.PlaneRow(c, y0 + y);
+                std::fill_n(dstp, width, 0.0f);
+
+                for (int k = 0; k < factor; ++k) {
+                    const float* srcp = band.ConstPlaneRow(c, y * factor + k);
+                    for (int x = 0; x < width; ++x) {
+                        float sum = 0.0f;
+                        for (int j = 0; j < factor; ++j)
+                            sum += srcp[x * factor + j];
+                        dstp[x] += sum;
+                    }
+                }
+
+                for (int x = 0; x < width; ++x)
+                    dstp[x] *= kNorm;
+            }
         }
     }
+    return true;
+}
+
+template <int factor>
+static FillFunc select_fill_downscaled(const VSVideoFormat* fi, bool linput) noexcept {
+    if (fi->colorFamily == cfYUV)
+        return (fi->bytesPerSample == 1) ? fill_downscaled<fill_yuv<uint8_t>, factor> : fill_downscaled<fill_yuv<uint16_t>, factor>;
+
+    switch (fi->bytesPerSample) {
+        case 1:
+            return (linput) ? fill_downscaled<fill_image<uint8_t, true>, factor> : fill_downscaled<fill_image<uint8_t, false>, factor>;
+        case 2:
+            return (linput) ? fill_downscaled<fill_image<uint16_t, true>, factor> : fill_downscaled<fill_image<uint16_t, false>, factor>;
+        default:
+            return (linput) ? fill_downscaled<fill_imageF<true>, factor> : fill_downscaled<fill_imageF<false>, factor>;
+    }
+}
+
+FillFunc select_fill(const VSVideoFormat* fi, bool linput, int downscale) noexcept {
+    if (downscale == 2)
+        return select_fill_downscaled<2>(fi, linput);
+    if (downscale == 4)
+        return select_fill_downscaled<4>(fi, linput);
 
-    if (!ref.SetFromImage(std::move(tmp1), (linput) ? jxl::ColorEncoding::LinearSRGB(false) : jxl::ColorEncoding::SRGB(false)) ||
-        !dist.SetFromImage(std::move(tmp2), (linput) ? jxl::ColorEncoding::LinearSRGB(false) : jxl::ColorEncoding::SRGB(false))) {
-        return;
+    if (fi->colorFamily == cfYUV)
+        return (fi->bytesPerSample == 1) ? fill_yuv<uint8_t> : fill_yuv<uint16_t>;
+
+    switch (fi->bytesPerSample) {
+        case 1:
+            return (linput) ? fill_image<uint8_t, true> : fill_image<uint8_t, false>;
+        case 2:
+            return (linput) ? fill_image<uint16_t, true> : fill_image<uint16_t, false>;
+        default:
+            return (linput) ? fill_imageF<true> : fill_imageF<false>;
     }
 }
 
-template void fill_image<uint8_t, true>(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept;
-template void fill_image<uint16_t, true>(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept;
+template bool fill_image<uint8_t, true>(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
+template bool fill_image<uint16_t, true>(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
+
+template bool fill_image<uint8_t, false>(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
+template bool fill_image<uint16_t, false>(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
 
-template void fill_image<uint8_t, false>(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept;
-template void fill_image<uint16_t, false>(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept;
+template bool fill_imageF<true>(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
+template bool fill_imageF<false>(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
 
-template void fill_imageF<true>(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept;
-template void fill_imageF<false>(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept;
\ No newline at end of file
+template bool fill_yuv<uint8_t>(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
+template bool fill_yuv<uint16_t>(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
\ No newline at end of file
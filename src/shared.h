@@ -4,52 +4,373 @@
 #include <jxl/color_encoding.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 #include "config.h"
+#include "kernels/kernels.h"
 #include "lib/extras/codec.h"
 #include "lib/include/jxl/memory_manager.h"
+#include "lib/jxl/butteraugli/butteraugli.h"
 #include "lib/jxl/enc_butteraugli_comparator.h"
+#include "lib/jxl/gauss_blur.h"
 #include "tools/ssimulacra.h"
 #include "tools/ssimulacra2.h"
+#include "vapoursynth/VSConstants4.h"
 #include "vapoursynth/VSHelper4.h"
 #include "vapoursynth/VapourSynth4.h"
 
-#ifdef PLUGIN_X86
-#include "vectorclass.h"
-#include "vectormath_exp.h"
-#endif
-
 extern void VS_CC agmCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi);
 extern void VS_CC autogainCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi);
 extern void VS_CC butteraugliCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi);
 extern void VS_CC colormapCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi);
+extern void VS_CC memorybudgetCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi);
+extern void VS_CC metricsummaryCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi);
+extern void VS_CC metricsCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi);
 extern void VS_CC rfsCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi);
 extern void VS_CC ssimulacraCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi);
 extern void VS_CC visualizediffsCreate(const VSMap* in, VSMap* out, void* userData, VSCore* core, const VSAPI* vsapi);
 
 extern VSNode* toRGBS(VSNode* source, VSCore* core, const VSAPI* vsapi);
+extern VSNode* toMetricInput(VSNode* source, VSCore* core, const VSAPI* vsapi);
+
+// Frames scored by a metric filter, set with step= and frames=. Every frame is scored when neither is given.
+struct FrameSelection final {
+    int step = 1;              // every step-th frame, 0 when only frames is used
+    std::vector<bool> frames;  // explicitly listed frames, indexed by frame number
+
+    bool contains(int n) const noexcept {
+        return (step && n % step == 0) || (n < static_cast<int>(frames.size()) && frames[n]);
+    }
+
+    bool all() const noexcept { return step == 1; }
+};
+
+// Window of the frame the metrics are computed on, set with left, top, width and height.
+struct MetricRegion final {
+    int left = 0, top = 0;
+    int width = 0, height = 0;
+
+    bool full(const VSVideoInfo* vi) const noexcept { return !left && !top && width == vi->width && height == vi->height; }
+};
+
+// Reads reference and distorted from in and converts them with toMetricInput. Returns false and sets error when
+// distorted is empty, a conversion fails or the clips don't share format and dimensions, with every node freed.
+bool read_metric_clips(const VSMap* in, VSNode*& node, std::vector<VSNode*>& node2, std::string& error, VSCore* core, const VSAPI* vsapi) noexcept;
+
+// Reads left, top, width and height from in, width and height default to the rest of the frame. Returns false and
+// sets error when the window doesn't fit in the frame.
+bool read_metric_region(const VSMap* in, const VSVideoInfo* vi, MetricRegion& region, std::string& error, const VSAPI* vsapi) noexcept;
+
+// Reads step and frames from in. Returns false and sets error on invalid values.
+bool read_frame_selection(const VSMap* in, int num_frames, FrameSelection& sel, std::string& error, const VSAPI* vsapi) noexcept;
+
+// Content hash of every plane of a frame, mixed with the frame properties the conversion to linear RGB depends on.
+uint64_t frame_hash(const VSFrame* frame, const VSAPI* vsapi) noexcept;
+bool frames_equal(const VSFrame* a, const VSFrame* b, const VSAPI* vsapi) noexcept;
+// Hash of the filter parameters a score depends on, the third part of a ScoreKey.
+uint64_t hash_values(const double* values, int count) noexcept;
+
+constexpr int kMaxCachedScores = 8;
+
+struct ScoreKey final {
+    uint64_t ref;
+    uint64_t dist;
+    uint64_t params;
+};
+
+// Plugin-wide LRU of scores, shared by every metric instance. It's split into shards with their own lock so
+// frame threads rarely wait on each other.
+bool score_cache_lookup(const ScoreKey& key, double* scores, int count) noexcept;
+void score_cache_insert(const ScoreKey& key, const double* scores, int count) noexcept;
 
+// Append-only file of scores, loaded when it's opened and shared by every instance using the same path.
+struct ScoreFile;
+std::shared_ptr<ScoreFile> open_score_file(const std::string& path, std::string& error);
+bool score_file_lookup(ScoreFile& file, const ScoreKey& key, double* scores, int count) noexcept;
+void score_file_insert(ScoreFile& file, const ScoreKey& key, const double* scores, int count) noexcept;
+// Writes <prefix>_DiskCacheHits, <prefix>_DiskCacheMisses, <prefix>_DiskCacheEntries and
+// <prefix>_DiskCacheWriteFailed, 1 once appending to the file failed.
+void set_score_file_props(VSMap* props, const char* prefix, ScoreFile& file, const VSAPI* vsapi) noexcept;
+
+// log=: per-frame scores written in frame order by a background thread, as CSV (.csv), JSON lines (.jsonl) or
+// binary (.bin: "JULEKLG1", uint32 column count, uint32 length + name per column, then an int32 frame number
+// and one double per column for every record).
+struct MetricLog;
+std::shared_ptr<MetricLog> open_metric_log(const std::string& path, const std::vector<std::string>& columns, const FrameSelection& sel, int num_frames, std::string& error);
+// scores holds one value per column. Returns false once a write has failed.
+bool metric_log_push(MetricLog& log, int frame, const double* scores) noexcept;
+
+// PSNR over every plane of the raw frames inside region, infinity for identical regions. Subsampled planes cover
+// every chroma sample the region touches.
+double frame_psnr(const VSFrame* a, const VSFrame* b, const MetricRegion& region, SSERowFunc sse_row, const VSAPI* vsapi) noexcept;
+
+// Shared pooled allocator, not charged to any filter instance.
 JxlMemoryManager* get_memory_manager();
 
+// Allocation counters of one filter instance. Its manager hands out blocks from the plugin-wide size-class pool,
+// so it must outlive everything allocated through it.
+struct MemoryStats final {
+    std::atomic<int64_t> live{0};
+    std::atomic<int64_t> peak{0};
+    std::atomic<int64_t> allocations{0};
+    std::atomic<int64_t> frames{0};
+    JxlMemoryManager manager;
+
+    MemoryStats() noexcept;
+    MemoryStats(const MemoryStats&) = delete;
+    MemoryStats& operator=(const MemoryStats&) = delete;
+};
+
+// Writes <prefix>_MemoryLive, <prefix>_MemoryPeak (bytes) and <prefix>_AllocationsPerFrame.
+void set_memory_props(VSMap* props, const char* prefix, const MemoryStats& stats, const VSAPI* vsapi) noexcept;
+
+// Held by a metric frame while it runs. Waits for memory to be freed first if SetMemoryBudget is exceeded, which
+// blocks the worker thread (see memory.cpp for why that's bounded).
+// Only memory in use counts: workspaces idle in a WorkspacePool are credited back with memory_idle_add.
+// The SSIMULACRA (feature 1 and 2) comparison runs in libjxl's ssimulacra::ComputeDiff, which allocates with
+// malloc. Its temporary images, several float planes of the frame size, aren't counted by the budget.
+class MemoryBudgetGuard final {
+   public:
+    explicit MemoryBudgetGuard(MemoryStats& stats) noexcept;
+    ~MemoryBudgetGuard();
+    MemoryBudgetGuard(const MemoryBudgetGuard&) = delete;
+    MemoryBudgetGuard& operator=(const MemoryBudgetGuard&) = delete;
+};
+
+// Adds bytes (negative to remove them) to the memory held by idle workspaces, which doesn't count against the budget.
+void memory_idle_add(int64_t bytes) noexcept;
+// True when the memory in use is over SetMemoryBudget, idle workspaces are then trimmed instead of kept.
+bool memory_over_budget() noexcept;
+
+// max_inflight without waiting on a worker thread: the filter is created as lanes fmParallelRequests instances
+// sharing data, lane i computes the frames i, i + lanes, ... one at a time and std.Interleave and std.Trim put
+// them back in order. get_frame receives the frame number of the full clip. Sets the clip in out, or returns
+// false and sets error. data is freed with the last lane either way.
+bool create_metric_lanes(VSMap* out, const char* name, const VSVideoInfo* vi, VSFilterGetFrame get_frame, std::shared_ptr<void> data, int lanes, const std::vector<VSFilterDependency>& deps, std::string& error, VSCore* core, const VSAPI* vsapi) noexcept;
+// max_inflight when it isn't given: as many frames of width x height as fit in about 3 GB, 0 (unlimited) when
+// that's at least the number of VapourSynth threads.
+int default_max_inflight(int width, int height, VSCore* core, const VSAPI* vsapi) noexcept;
+
+// Buffers of the fill functions, kept in the workspace so converting a frame doesn't allocate once it has the size.
+struct FillScratch final {
+    std::vector<int> x0, x1;  // horizontal chroma taps of yuv_to_linear
+    std::vector<float> wx;
+    std::vector<float> yrow, urow, vrow;
+    std::vector<float> crow0, crow1, ctmp;
+    jxl::Image3F band;  // full resolution rows of downscale=2/4, counted by MetricWorkspace::pooled_bytes
+    JxlMemoryManager* memory_manager = get_memory_manager();  // allocates band
+    const char* error = nullptr;                              // why the last fill returned false
+
+    // Bytes of the vectors, which come from the C++ allocator.
+    size_t bytes() const noexcept;
+};
+
+// The fill functions write linear sRGB, converting from sRGB or the YUV frame's transfer as needed.
+// img receives the width x height window of the frame starting at (left, top), read in place through the plane pointers.
+// They return false and set scratch.error when the frame can't be converted (PQ and HLG aren't supported) or the
+// downscale band can't be allocated.
 template <typename pixel_t, bool linput>
-extern void fill_image(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept;
+extern bool fill_image(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
 template <bool linput>
-extern void fill_imageF(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept;
-
-#if defined(_MSC_VER)
-#define FORCE_INLINE inline __forceinline
-#else
-#define FORCE_INLINE inline __attribute__((always_inline))
-#endif
-
-struct AGMData final {
-    VSNode* node;
-    const VSVideoInfo* vi;
-    float luma_scaling;
-    float float_range[256];
-    int shift, peak;
-    void (*process)(const VSFrame* src, VSFrame* dst, float& avg, const AGMData* const VS_RESTRICT d, const VSAPI* vsapi) noexcept;
-};
\ No newline at end of file
+extern bool fill_imageF(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
+template <typename pixel_t>
+extern bool fill_yuv(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
+
+using FillFunc = bool (*)(jxl::Image3F& img, const VSFrame* src, int left, int top, int width, int height, FillScratch& scratch, const VSAPI* vsapi) noexcept;
+// downscale 2 or 4 returns a fill producing the area-averaged image: left and top stay in frame pixels, width and
+// height are the size of the output.
+FillFunc select_fill(const VSVideoFormat* fi, bool linput, int downscale = 1) noexcept;
+
+// Diff map wrappers of the norm kernels.
+void accumulate_norms(const jxl::ImageF& diff_map, int y0, int y1, double q, NormAccumulator& acc) noexcept;
+ButteraugliNorms compute_norms(const jxl::ImageF& diff_map, double q) noexcept;
+// Writes the _BUTTERAUGLI_* norm props, with an _<index> suffix when index >= 0.
+void set_butteraugli_norms(VSMap* props, const ButteraugliNorms& norms, int index, const VSAPI* vsapi) noexcept;
+
+// Per-block max and mean of an error map. Rows can be added in pieces, so strips are pooled as they're done.
+struct BlockStats final {
+    int blocksize = 0, width = 0, height = 0;
+    int cols = 0, rows = 0;
+    std::vector<float> max;
+    std::vector<double> sum;
+
+    void init(int block, int w, int h);
+    // Adds the frame rows [y0, y1), row y is read from map row y - map_top.
+    void add_rows(const jxl::ImageF& map, int map_top, int y0, int y1) noexcept;
+};
+
+// Writes <prefix>_BlockMax<suffix> and <prefix>_BlockMean<suffix> (row-major float arrays), the grid size as
+// <prefix>_BlockCols/_BlockRows and the block coordinates of the worst blocks by max as <prefix>_WorstBlocks (x, y pairs).
+void set_block_props(VSMap* props, const char* prefix, const std::string& suffix, const BlockStats& stats, const VSAPI* vsapi) noexcept;
+
+// (Re)allocates img only when its size changes, so buffers kept between frames or strips are reused.
+jxl::Status ensure_size(JxlMemoryManager* mm, jxl::Image3F& img, size_t width, size_t height);
+
+// Read-only view of three float planes, backed by either a jxl::Image3F or the planes of an RGBS frame.
+struct PlaneView3 final {
+    const float* ptr[3];
+    ptrdiff_t stride[3];  // in floats
+    size_t xsize, ysize;
+
+    const float* Row(size_t c, size_t y) const noexcept { return ptr[c] + y * stride[c]; }
+};
+
+PlaneView3 image_view(const jxl::Image3F& img) noexcept;
+PlaneView3 frame_view(const VSFrame* src, const VSAPI* vsapi) noexcept;
+PlaneView3 frame_view(const VSFrame* src, int left, int top, int width, int height, const VSAPI* vsapi) noexcept;
+
+struct SSIMULACRA2Scale final {
+    jxl::Image3F img;       // positive XYB
+    jxl::Image3F mu;        // blurred img
+    jxl::Image3F sigma_sq;  // blurred img * img
+};
+
+struct SSIMULACRA2Reference final {
+    std::vector<SSIMULACRA2Scale> scales;
+};
+
+struct SSIMULACRA2ScratchScale final {
+    jxl::Image3F downscaled;  // input at this scale, unused at scale 0
+    jxl::Image3F img2;
+    jxl::Image3F mul;
+    jxl::Image3F sigma2_sq;
+    jxl::Image3F sigma12;
+    jxl::Image3F mu2;
+};
+
+// Temporaries of the SSIMULACRA2 passes, kept between frames so a clip of constant size allocates them only once.
+struct SSIMULACRA2Scratch final {
+    std::vector<SSIMULACRA2ScratchScale> scales;
+    hwy::AlignedUniquePtr<jxl::RecursiveGaussian> rg;
+    jxl::ImageF blur_temp;
+    size_t blur_w = 0, blur_h = 0;  // allocated size of blur_temp, it's shrunk to the size of each scale
+    JxlMemoryManager* memory_manager = get_memory_manager();
+};
+
+jxl::Status ssimulacra2_reference(const PlaneView3& linear, SSIMULACRA2Reference& ref, SSIMULACRA2Scratch& scratch);
+// error_map, when not null, receives the full resolution SSIM error (1 - SSIM averaged over the XYB planes).
+jxl::StatusOr<Msssim> ssimulacra2_compare(const SSIMULACRA2Reference& ref, const PlaneView3& linear, SSIMULACRA2Scratch& scratch, jxl::ImageF* error_map = nullptr);
+
+// One band of a Butteraugli comparison, rows [top, bottom) of the frame of which [y0, y1) are kept.
+struct ButteraugliBand final {
+    int top, bottom;  // rows read from the frame
+    int y0, y1;       // rows of the diff map written by this band
+    jxl::Image3F ref;
+    jxl::Image3F dist;
+    jxl::ImageF diff_map;
+    std::unique_ptr<jxl::ButteraugliComparator> comparator;
+};
+
+// Rows a band reads past the rows it writes, on both sides. This covers the support of the blurs and of the
+// half resolution pass, so a band's interior sees the same neighbourhood as in the full frame.
+constexpr int kBandOverlap = 128;
+// Smallest interior of a band split for threads, so the overlap adds at most half of the rows to a band.
+constexpr int kMinBandRows = 4 * kBandOverlap;
+
+// Splits height rows into num_bands bands. bands keeps its images, so the bands of a frame of the same size reuse them.
+void make_bands(int height, int num_bands, std::vector<ButteraugliBand>& bands);
+// Build the reference side of every band, then compare every band and stitch the interior rows of the band diff
+// maps into diff_map. runner is a JxlThreadParallelRunner that isn't running anything else.
+bool band_references(void* runner, const jxl::ButteraugliParams& params, std::vector<ButteraugliBand>& bands, const jxl::Image3F& ref);
+bool band_diffmap(void* runner, std::vector<ButteraugliBand>& bands, const jxl::Image3F& dist, jxl::ImageF& diff_map);
+
+// Per-frame lists of the metric filters, indexed by distorted clip unless noted.
+struct FrameScratch final {
+    std::vector<const VSFrame*> src2;
+    std::vector<uint64_t> dist_hash;
+    std::vector<double> psnr;
+    std::vector<uint8_t> gated;
+    std::vector<int> pending;  // clips that are compared
+    std::vector<ButteraugliNorms> norms;
+    std::vector<std::array<double, 2>> ssim;  // SSIMULACRA2 and SSIMULACRA scores
+    std::vector<NormAccumulator> acc;
+    std::vector<BlockStats> blocks;
+    std::vector<double> log_row;  // every score of the frame
+
+    // Resizes the lists to num_dist clips, keeping their capacity.
+    void reset(int num_dist);
+    size_t bytes() const noexcept;
+};
+
+// Everything a metric frame needs on the plugin side. One exists per frame in flight and is reused afterwards,
+// so once a clip of constant size has gone through a few frames nothing in it is allocated again.
+// The ButteraugliComparator of each band is rebuilt for every frame inside libjxl and isn't counted by bytes(),
+// it allocates through the instance's memory manager and shows up in _*_MemoryLive.
+struct MetricWorkspace final {
+    jxl::Image3F ref;
+    jxl::Image3F dist;
+    jxl::ImageF diff_map;
+    SSIMULACRA2Reference ref_pyramid;
+    SSIMULACRA2Scratch scratch;
+    FillScratch fill;
+    FrameScratch frame;
+    std::vector<ButteraugliBand> bands;  // banded Butteraugli with threads > 1
+    ButteraugliBand strip;               // Butteraugli strip mode
+    size_t accounted = 0;                // bytes() at the last release, owned by the pool
+    size_t idle_credit = 0;              // pooled_bytes() credited to the budget while idle, owned by the pool
+
+    // Sizes ref and dist to width x height, they're only reallocated when the size changes.
+    jxl::Status ensure_images(size_t width, size_t height);
+    // Frees every image, the next frame allocates them again.
+    void trim() noexcept;
+    // Bytes of the images, which are allocated through the memory manager and count against the budget.
+    size_t pooled_bytes() const noexcept;
+    // pooled_bytes() and the lists, which come from the C++ allocator.
+    size_t bytes() const noexcept;
+};
+
+// Smallest strip of the low memory mode, shorter strips would be mostly overlap.
+constexpr int kMinStripRows = 2 * kBandOverlap;
+
+// Fills img with the linear RGB rows [top, top + rows) of the reference (clip -1) or of distorted clip clip.
+// Returns false with the reason in the workspace's fill.error.
+using StripFill = std::function<bool(jxl::Image3F& img, int clip, int top, int rows)>;
+// Receives the rows [y0, y1) of a strip's diff map for a clip, row y is map row y - map_top.
+using StripRows = std::function<void(int clip, const jxl::ImageF& map, int map_top, int y0, int y1)>;
+
+// Low memory Butteraugli: compares the clips one overlapping strip of about strip rows at a time, so only strip
+// sized images (ws.strip) are live. Returns false and sets error on failure.
+bool strip_compare(int width, int height, int strip, const std::vector<int>& clips, const jxl::ButteraugliParams& params, MetricWorkspace& ws, const StripFill& fill, const StripRows& rows, std::string& error);
+
+// Free list of workspaces owned by a filter instance. Frames take one for the duration of the call,
+// so at most as many are created as there are frames processed at the same time.
+class WorkspacePool final {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<MetricWorkspace>> workspaces;
+    std::vector<MetricWorkspace*> idle;
+    size_t total = 0;
+    size_t peak = 0;
+    JxlMemoryManager* memory_manager = get_memory_manager();
+
+   public:
+    WorkspacePool() = default;
+    ~WorkspacePool();
+    WorkspacePool(const WorkspacePool&) = delete;
+    WorkspacePool& operator=(const WorkspacePool&) = delete;
+
+    // Workspaces allocate through mm, set it before the first frame.
+    void set_memory_manager(JxlMemoryManager* mm) noexcept;
+    // Returns a workspace whose ref/dist images are width x height, nullptr if they can't be allocated.
+    // Without a size the images are left as the last frame had them, call ensure_images when they're needed.
+    MetricWorkspace* acquire(size_t width = 0, size_t height = 0) noexcept;
+    // Keeps ws for the next frame, trimmed when the plugin is over its memory budget.
+    void release(MetricWorkspace* ws) noexcept;
+    // Largest total size of all workspaces seen so far, in bytes.
+    size_t high_water() noexcept;
+};
+
+// Both return false when the transfer is PQ or HLG, which aren't converted to linear light.
+bool yuv_conversion(YUVConversion& conv, const VSVideoFormat* fi, const VSMap* props, int height, const VSAPI* vsapi) noexcept;
+// Same with the _Matrix, _ColorRange, _Transfer, _Primaries and _ChromaLocation values given directly.
+bool yuv_conversion(YUVConversion& conv, const VSVideoFormat* fi, int matrix, int range, int transfer, int primaries, int chroma_loc, int height) noexcept;
+template <typename pixel_t>
+void yuv_to_linear(jxl::Image3F& dst, const uint8_t* const srcp[3], const ptrdiff_t stride[3], int left, int top, int width, int height, int frame_width, int frame_height, const YUVConversion& conv, FillScratch& scratch) noexcept;
\ No newline at end of file
@@ -2,94 +2,259 @@
 
 struct SSIMULACRAData final {
     VSNode* node;
-    VSNode* node2;
+    std::vector<VSNode*> node2;
     const VSVideoInfo* vi;
     bool simple;
+    bool linput;
+    bool zero_copy;
     int feature;
+    int blocksize;  // side of the pooled SSIMULACRA2 error map blocks, 0 when disabled
+    bool memo;      // scores are looked up in the score cache, only without blocks
+    uint64_t params_hash;
+    std::shared_ptr<ScoreFile> score_file;  // cache_path, shared with other instances using the same file
+    std::shared_ptr<MetricLog> log;
+    double gate_psnr;  // pairs at least this close are not scored and get no score props, 0 when disabled
+    int downscale;     // 1, 2 or 4
+    MetricRegion region;
+    SSERowFunc sse_row;
+    FrameSelection selection;
+    MemoryStats memory;  // declared before workspaces, it must outlive them
+    WorkspacePool workspaces;
 
-    void (*fill)(jxl::CodecInOut& ref, jxl::CodecInOut& dist, const VSFrame* src1, const VSFrame* src2, int width, int height, const VSAPI* vsapi) noexcept;
+    FillFunc fill;
 };
 
+static void set_score(VSMap* props, const char* name, double score, int index, const VSAPI* vsapi) noexcept {
+    if (index < 0) {
+        vsapi->mapSetFloat(props, name, score, maReplace);
+    } else {
+        vsapi->mapSetFloat(props, (std::string(name) + "_" + std::to_string(index)).c_str(), score, maReplace);
+    }
+}
+
+static void set_error_blocks(VSMap* props, const jxl::ImageF& error_map, int blocksize, int index, BlockStats& blocks, const VSAPI* vsapi) noexcept {
+    blocks.init(blocksize, static_cast<int>(error_map.xsize()), static_cast<int>(error_map.ysize()));
+    blocks.add_rows(error_map, 0, 0, static_cast<int>(error_map.ysize()));
+    set_block_props(props, "_SSIMULACRA2", (index < 0) ? "" : "_" + std::to_string(index), blocks, vsapi);
+}
+
 static const VSFrame* VS_CC ssimulacraGetFrame(int n, int activationReason, void* instanceData, void** frameData, VSFrameContext* frameCtx, VSCore* core, const VSAPI* vsapi) {
     auto d{static_cast<SSIMULACRAData*>(instanceData)};
 
     if (activationReason == arInitial) {
+        // Frames that aren't scored only need the distorted frame they pass through.
+        if (!d->selection.contains(n)) {
+            vsapi->requestFrameFilter(n, d->node2[0], frameCtx);
+            return nullptr;
+        }
+
         vsapi->requestFrameFilter(n, d->node, frameCtx);
-        vsapi->requestFrameFilter(n, d->node2, frameCtx);
+        for (auto node2 : d->node2)
+            vsapi->requestFrameFilter(n, node2, frameCtx);
     } else if (activationReason == arAllFramesReady) {
-        const VSFrame* src = vsapi->getFrameFilter(n, d->node, frameCtx);
-        const VSFrame* src2 = vsapi->getFrameFilter(n, d->node2, frameCtx);
+        if (!d->selection.contains(n))
+            return vsapi->getFrameFilter(n, d->node2[0], frameCtx);
+
+        MemoryBudgetGuard budget(d->memory);
 
-        int width = vsapi->getFrameWidth(src2, 0);
-        int height = vsapi->getFrameHeight(src2, 0);
+        // The per-frame lists and images all come from the workspace, sized by earlier frames.
+        MetricWorkspace* ws = d->workspaces.acquire();
+        FrameScratch& f = ws->frame;
+        const int num_dist = static_cast<int>(d->node2.size());
+        f.reset(num_dist);
 
-        jxl::CodecInOut ref{get_memory_manager()};
-        jxl::CodecInOut dist{get_memory_manager()};
-        jxl::ImageF diff_map;
+        const VSFrame* src = vsapi->getFrameFilter(n, d->node, frameCtx);
+        for (int i = 0; i < num_dist; i++)
+            f.src2[i] = vsapi->getFrameFilter(n, d->node2[i], frameCtx);
 
-        if (!ref.SetSize(width, height) || !dist.SetSize(width, height)) {
-            vsapi->setFilterError("SSIMULACRA: Failed to set image size", frameCtx);
+        auto free_frames = [&]() {
             vsapi->freeFrame(src);
-            vsapi->freeFrame(src2);
-            return nullptr;
+            for (auto frame : f.src2)
+                vsapi->freeFrame(frame);
+            d->workspaces.release(ws);
+        };
+
+        // The metric runs on the region, area-averaged with downscale. fill reads both straight from the frames.
+        int width = d->region.width / d->downscale;
+        int height = d->region.height / d->downscale;
+
+        const bool ssim2 = !d->feature || d->feature == 2;
+        const bool ssim1 = !!d->feature;
+        // f.ssim holds [0] SSIMULACRA2, [1] SSIMULACRA, the same layout is used in the score cache.
+        std::vector<std::array<double, 2>>& scores = f.ssim;
+
+        // Identical pairs, pairs that were scored before and pairs under the PSNR gate skip the comparison,
+        // f.pending lists the others.
+        int memoized = 0;
+
+        const bool hashed = d->memo || d->score_file;
+        const uint64_t ref_hash = hashed ? frame_hash(src, vsapi) : 0;
+
+        for (int i = 0; i < num_dist; i++) {
+            if (hashed) {
+                f.dist_hash[i] = frame_hash(f.src2[i], vsapi);
+
+                if (f.dist_hash[i] == ref_hash && frames_equal(src, f.src2[i], vsapi)) {
+                    scores[i] = {100.0, 0.0};
+                    memoized++;
+                    continue;
+                }
+                if ((d->memo && score_cache_lookup({ref_hash, f.dist_hash[i], d->params_hash}, scores[i].data(), 2)) ||
+                    (d->score_file && score_file_lookup(*d->score_file, {ref_hash, f.dist_hash[i], d->params_hash}, scores[i].data(), 2))) {
+                    memoized++;
+                    continue;
+                }
+            }
+
+            if (d->gate_psnr > 0.0) {
+                f.psnr[i] = frame_psnr(src, f.src2[i], d->region, d->sse_row, vsapi);
+                if (f.psnr[i] >= d->gate_psnr) {
+                    // No score at all, so aggregates can't mistake a skipped pair for a perfect one.
+                    scores[i] = {std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN()};
+                    f.gated[i] = true;
+                    continue;
+                }
+            }
+
+            f.pending.push_back(i);
         }
 
-        d->fill(ref, dist, src, src2, width, height, vsapi);
+        // The zero-copy path reads the frames directly and only needs the pyramid buffers.
+        const bool full = !d->zero_copy && !f.pending.empty();
+        if (full && !ws->ensure_images(width, height)) {
+            vsapi->setFilterError("SSIMULACRA: Failed to allocate image", frameCtx);
+            free_frames();
+            return nullptr;
+        }
+        SSIMULACRA2Reference& ref_pyramid = ws->ref_pyramid;
+        jxl::ImageF* error_map = d->blocksize ? &ws->diff_map : nullptr;
+        f.blocks.resize(d->blocksize ? 1 : 0);
 
-        VSFrame* dst = vsapi->copyFrame(src2, core);
+        VSFrame* dst = vsapi->copyFrame(f.src2[0], core);
         VSMap* dstProps = vsapi->getFramePropertiesRW(dst);
 
-        if (!d->feature || d->feature == 2) {
-            auto result = ComputeSSIMULACRA2(ref.Main(), dist.Main());
-            if (result.ok()) {
-                if (result.ok()) {
-                    Msssim msssim = std::move(result).value_();
-                    vsapi->mapSetFloat(dstProps, "_SSIMULACRA2", msssim.Score(), maReplace);
-                } else {
-                    vsapi->setFilterError("SSIMULACRA: ComputeSSIMULACRA2 failed", frameCtx);
+        if (!f.pending.empty()) {
+            // Linear RGBS input feeding only SSIMULACRA2 is read straight from the frame planes.
+            jxl::Image3F& ref = ws->ref;
+            if (!d->zero_copy && !d->fill(ref, src, d->region.left, d->region.top, width, height, ws->fill, vsapi)) {
+                vsapi->setFilterError((std::string("SSIMULACRA: ") + ws->fill.error).c_str(), frameCtx);
+                vsapi->freeFrame(dst);
+                free_frames();
+                return nullptr;
+            }
+
+            // The reference XYB pyramid is built once per frame and shared by all distorted clips.
+            if (ssim2 && !ssimulacra2_reference(d->zero_copy ? frame_view(src, d->region.left, d->region.top, width, height, vsapi) : image_view(ref), ref_pyramid, ws->scratch)) {
+                vsapi->setFilterError("SSIMULACRA: Failed to build the SSIMULACRA2 reference", frameCtx);
+                vsapi->freeFrame(dst);
+                free_frames();
+                return nullptr;
+            }
+
+            for (int i : f.pending) {
+                const int index = (num_dist == 1) ? -1 : i;
+                jxl::Image3F& dist = ws->dist;
+                if (!d->zero_copy && !d->fill(dist, f.src2[i], d->region.left, d->region.top, width, height, ws->fill, vsapi)) {
+                    vsapi->setFilterError((std::string("SSIMULACRA: ") + ws->fill.error).c_str(), frameCtx);
                     vsapi->freeFrame(dst);
-                    vsapi->freeFrame(src);
-                    vsapi->freeFrame(src2);
+                    free_frames();
                     return nullptr;
                 }
+
+                if (ssim2) {
+                    auto result = ssimulacra2_compare(ref_pyramid, d->zero_copy ? frame_view(f.src2[i], d->region.left, d->region.top, width, height, vsapi) : image_view(dist), ws->scratch, error_map);
+                    if (result.ok()) {
+                        Msssim msssim = std::move(result).value_();
+                        scores[i][0] = msssim.Score();
+                        if (error_map)
+                            set_error_blocks(dstProps, *error_map, d->blocksize, index, f.blocks[0], vsapi);
+                    } else {
+                        vsapi->setFilterError("SSIMULACRA: ComputeSSIMULACRA2 failed", frameCtx);
+                        vsapi->freeFrame(dst);
+                        free_frames();
+                        return nullptr;
+                    }
+                }
+
+                if (ssim1) {
+                    // Allocates with malloc inside libjxl, outside the memory budget (see MemoryBudgetGuard).
+                    auto result = ssimulacra::ComputeDiff(ref, dist, d->simple);
+                    if (result.ok()) {
+                        ssimulacra::Ssimulacra ssimulacra_ = std::move(result).value_();
+                        scores[i][1] = ssimulacra_.Score();
+                    } else {
+                        vsapi->setFilterError("SSIMULACRA: ssimulacra::ComputeDiff failed", frameCtx);
+                        vsapi->freeFrame(dst);
+                        free_frames();
+                        return nullptr;
+                    }
+                }
+
+                if (d->memo)
+                    score_cache_insert({ref_hash, f.dist_hash[i], d->params_hash}, scores[i].data(), 2);
+                if (d->score_file)
+                    score_file_insert(*d->score_file, {ref_hash, f.dist_hash[i], d->params_hash}, scores[i].data(), 2);
             }
         }
 
-        if (d->feature) {
-            if (!ref.Main().TransformTo(jxl::ColorEncoding::LinearSRGB(false), *JxlGetDefaultCms()) ||
-                !dist.Main().TransformTo(jxl::ColorEncoding::LinearSRGB(false), *JxlGetDefaultCms())) {
-                vsapi->setFilterError("SSIMULACRA: Failed to transform to Linear SRGB", frameCtx);
+        for (int i = 0; i < num_dist; i++) {
+            if (f.gated[i])
+                continue;
+            const int index = (num_dist == 1) ? -1 : i;
+            if (ssim2)
+                set_score(dstProps, "_SSIMULACRA2", scores[i][0], index, vsapi);
+            if (ssim1)
+                set_score(dstProps, "_SSIMULACRA", scores[i][1], index, vsapi);
+        }
+
+        if (d->log) {
+            for (int i = 0; i < num_dist; i++) {
+                if (ssim2)
+                    f.log_row.push_back(scores[i][0]);
+                if (ssim1)
+                    f.log_row.push_back(scores[i][1]);
+            }
+            if (!metric_log_push(*d->log, n, f.log_row.data())) {
+                vsapi->setFilterError("SSIMULACRA: failed to write the log", frameCtx);
                 vsapi->freeFrame(dst);
-                vsapi->freeFrame(src);
-                vsapi->freeFrame(src2);
+                free_frames();
                 return nullptr;
             }
+        }
 
-            auto result = ssimulacra::ComputeDiff(*ref.Main().color(), *dist.Main().color(), d->simple);
-            if (result.ok()) {
-                ssimulacra::Ssimulacra ssimulacra_ = std::move(result).value_();
-                vsapi->mapSetFloat(dstProps, "_SSIMULACRA", ssimulacra_.Score(), maReplace);
-            } else {
-                vsapi->setFilterError("SSIMULACRA: ssimulacra::ComputeDiff failed", frameCtx);
-                vsapi->freeFrame(dst);
-                vsapi->freeFrame(src);
-                vsapi->freeFrame(src2);
-                return nullptr;
+        if (d->memo || d->score_file)
+            vsapi->mapSetInt(dstProps, "_SSIMULACRA_Memoized", memoized, maReplace);
+
+        if (d->gate_psnr > 0.0) {
+            for (int i = 0; i < num_dist; i++) {
+                const std::string suffix = (num_dist == 1) ? "" : "_" + std::to_string(i);
+                vsapi->mapSetInt(dstProps, ("_SSIMULACRA_Gated" + suffix).c_str(), f.gated[i], maReplace);
+                if (!std::isnan(f.psnr[i]))
+                    vsapi->mapSetFloat(dstProps, ("_SSIMULACRA_PSNR" + suffix).c_str(), f.psnr[i], maReplace);
             }
         }
+        if (d->score_file)
+            set_score_file_props(dstProps, "_SSIMULACRA", *d->score_file, vsapi);
 
-        vsapi->freeFrame(src);
-        vsapi->freeFrame(src2);
+        free_frames();
+        vsapi->mapSetInt(dstProps, "_SSIMULACRA_Scored", 1, maReplace);
+        vsapi->mapSetInt(dstProps, "_SSIMULACRA_WorkspacePeak", static_cast<int64_t>(d->workspaces.high_water()), maReplace);
+        set_memory_props(dstProps, "_SSIMULACRA", d->memory, vsapi);
         return dst;
     }
     return nullptr;
 }
 
+static void free_nodes(SSIMULACRAData* d, const VSAPI* vsapi) {
+    vsapi->freeNode(d->node);
+    for (auto node2 : d->node2)
+        vsapi->freeNode(node2);
+}
+
 static void VS_CC ssimulacraFree(void* instanceData, VSCore* core, const VSAPI* vsapi) {
     auto d{reinterpret_cast<SSIMULACRAData*>(instanceData)};
 
-    vsapi->freeNode(d->node);
-    vsapi->freeNode(d->node2);
+    free_nodes(d, vsapi);
     delete d;
 }
 
@@ -97,18 +262,12 @@ void VS_CC ssimulacraCreate(const VSMap* in, VSMap* out, void* userData, VSCore*
     auto d{std::make_unique<SSIMULACRAData>()};
     int err{0};
 
-    VSNode* node = vsapi->mapGetNode(in, "reference", 0, nullptr);
-    VSNode* node2 = vsapi->mapGetNode(in, "distorted", 0, nullptr);
-
-    d->node = toRGBS(node, core, vsapi);
-    d->node2 = toRGBS(node2, core, vsapi);
-
-    if (!d->node || !d->node2) {
-        vsapi->mapSetError(out, "SSIMULACRA: Failed to convert input to RGBS");
-        if (d->node) vsapi->freeNode(d->node);
-        if (d->node2) vsapi->freeNode(d->node2);
+    std::string clips_error;
+    if (!read_metric_clips(in, d->node, d->node2, clips_error, core, vsapi)) {
+        vsapi->mapSetError(out, ("SSIMULACRA: " + clips_error).c_str());
         return;
     }
+    const int num_dist = static_cast<int>(d->node2.size());
     d->vi = vsapi->getVideoInfo(d->node);
 
     d->feature = vsapi->mapGetIntSaturated(in, "feature", 0, &err);
@@ -119,55 +278,173 @@ void VS_CC ssimulacraCreate(const VSMap* in, VSMap* out, void* userData, VSCore*
     if (err)
         d->simple = false;
 
-    if (d->vi->format.colorFamily != cfRGB) {
-        vsapi->mapSetError(out, "SSIMULACRA: the clip must be in RGB format.");
-        vsapi->freeNode(d->node);
-        vsapi->freeNode(d->node2);
+    d->linput = !!vsapi->mapGetInt(in, "linput", 0, &err);
+    if (err)
+        d->linput = false;
+
+    std::string selection_error;
+    if (!read_frame_selection(in, d->vi->numFrames, d->selection, selection_error, vsapi)) {
+        vsapi->mapSetError(out, ("SSIMULACRA: " + selection_error).c_str());
+        free_nodes(d.get(), vsapi);
         return;
     }
 
-    int bits = d->vi->format.bitsPerSample;
-    if (bits != 8 && bits != 16 && bits != 32) {
-        vsapi->mapSetError(out, "SSIMULACRA: the clip bit depth must be 8, 16, or 32.");
-        vsapi->freeNode(d->node);
-        vsapi->freeNode(d->node2);
+    if (d->vi->format.colorFamily != cfRGB && d->vi->format.colorFamily != cfYUV) {
+        vsapi->mapSetError(out, "SSIMULACRA: the clip must be in RGB or YUV format.");
+        free_nodes(d.get(), vsapi);
         return;
     }
 
-    if (!vsh::isSameVideoInfo(vsapi->getVideoInfo(d->node2), d->vi)) {
-        vsapi->mapSetError(out, "SSIMULACRA: both clips must have the same format and dimensions.");
-        vsapi->freeNode(d->node);
-        vsapi->freeNode(d->node2);
+    int bits = d->vi->format.bitsPerSample;
+    if ((d->vi->format.sampleType == stInteger && bits > 16) || (d->vi->format.sampleType == stFloat && bits != 32)) {
+        vsapi->mapSetError(out, "SSIMULACRA: the clip must be 8-16 bit integer or 32 bit float.");
+        free_nodes(d.get(), vsapi);
         return;
     }
 
     if (d->feature < 0 || d->feature > 2) {
         vsapi->mapSetError(out, "SSIMULACRA: feature must be 0, 1, or 2.");
-        vsapi->freeNode(d->node);
-        vsapi->freeNode(d->node2);
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    d->blocksize = vsapi->mapGetIntSaturated(in, "blocksize", 0, &err);
+    if (err)
+        d->blocksize = 0;
+
+    if (d->blocksize < 0) {
+        vsapi->mapSetError(out, "SSIMULACRA: blocksize must be 0 (disabled) or greater.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    if (d->blocksize && d->feature == 1) {
+        vsapi->mapSetError(out, "SSIMULACRA: blocksize requires SSIMULACRA2 (feature 0 or 2).");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    std::string region_error;
+    if (!read_metric_region(in, d->vi, d->region, region_error, vsapi)) {
+        vsapi->mapSetError(out, ("SSIMULACRA: " + region_error).c_str());
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    int max_inflight = vsapi->mapGetIntSaturated(in, "max_inflight", 0, &err);
+    if (err) {
+        max_inflight = -1;  // derived from the frame size once downscale is known
+    } else if (max_inflight < 0) {
+        vsapi->mapSetError(out, "SSIMULACRA: max_inflight must be 0 (unlimited) or greater.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    d->downscale = vsapi->mapGetIntSaturated(in, "downscale", 0, &err);
+    if (err)
+        d->downscale = 1;
+
+    if (d->downscale != 1 && d->downscale != 2 && d->downscale != 4) {
+        vsapi->mapSetError(out, "SSIMULACRA: downscale must be 1, 2 or 4.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    if (d->region.width / d->downscale < 8 || d->region.height / d->downscale < 8) {
+        vsapi->mapSetError(out, "SSIMULACRA: minimum image size after downscale is 8x8 pixels.");
+        free_nodes(d.get(), vsapi);
         return;
     }
 
+    d->gate_psnr = vsapi->mapGetFloat(in, "gate_psnr", 0, &err);
+    if (err)
+        d->gate_psnr = 0.0;
+
+    if (d->gate_psnr < 0.0) {
+        vsapi->mapSetError(out, "SSIMULACRA: gate_psnr must be 0.0 (disabled) or greater.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    if (d->gate_psnr > 0.0 && d->blocksize) {
+        vsapi->mapSetError(out, "SSIMULACRA: 'gate_psnr' cannot be combined with 'blocksize'.");
+        free_nodes(d.get(), vsapi);
+        return;
+    }
+
+    d->memo = !!vsapi->mapGetInt(in, "memo", 0, &err);
+
+    // Only the scores are cached.
+    if (d->blocksize)
+        d->memo = false;
+
     if (d->vi->height < 8 || d->vi->width < 8) {
         vsapi->mapSetError(out, "SSIMULACRA: minimum image size is 8x8 pixels.");
-        vsapi->freeNode(d->node);
-        vsapi->freeNode(d->node2);
+        free_nodes(d.get(), vsapi);
         return;
     }
 
-    switch (d->vi->format.bytesPerSample) {
-        case 1:
-            d->fill = fill_image<uint8_t, false>;
-            break;
-        case 2:
-            d->fill = fill_image<uint16_t, false>;
-            break;
-        case 4:
-            d->fill = fill_imageF<false>;
-            break;
+    d->fill = select_fill(&d->vi->format, d->linput, d->downscale);
+    d->sse_row = select_sse_row(d->vi->format.bytesPerSample);
+    d->workspaces.set_memory_manager(&d->memory.manager);
+    d->zero_copy = d->linput && !d->feature && d->downscale == 1 && d->vi->format.colorFamily == cfRGB && d->vi->format.sampleType == stFloat;
+
+    const double params[] = {2.0, static_cast<double>(d->vi->format.colorFamily), static_cast<double>(d->vi->format.sampleType), static_cast<double>(d->vi->format.bitsPerSample), static_cast<double>(d->vi->format.subSamplingW), static_cast<double>(d->vi->format.subSamplingH), static_cast<double>(d->linput), static_cast<double>(d->feature), static_cast<double>(d->simple), static_cast<double>(d->downscale), static_cast<double>(d->region.left), static_cast<double>(d->region.top), static_cast<double>(d->region.width), static_cast<double>(d->region.height)};
+    d->params_hash = hash_values(params, static_cast<int>(std::size(params)));
+
+    const char* cache_path = vsapi->mapGetData(in, "cache_path", 0, &err);
+    if (!err && cache_path[0]) {
+        if (d->blocksize) {
+            vsapi->mapSetError(out, "SSIMULACRA: 'cache_path' cannot be combined with 'blocksize'.");
+            free_nodes(d.get(), vsapi);
+            return;
+        }
+
+        std::string cache_error;
+        d->score_file = open_score_file(cache_path, cache_error);
+        if (!d->score_file) {
+            vsapi->mapSetError(out, ("SSIMULACRA: " + cache_error).c_str());
+            free_nodes(d.get(), vsapi);
+            return;
+        }
+    }
+
+    const char* log_path = vsapi->mapGetData(in, "log", 0, &err);
+    if (!err && log_path[0]) {
+        std::vector<std::string> columns;
+        for (int i = 0; i < num_dist; i++) {
+            const std::string suffix = (num_dist == 1) ? "" : "_" + std::to_string(i);
+            if (!d->feature || d->feature == 2)
+                columns.push_back("_SSIMULACRA2" + suffix);
+            if (d->feature)
+                columns.push_back("_SSIMULACRA" + suffix);
+        }
+
+        std::string log_error;
+        d->log = open_metric_log(log_path, columns, d->selection, d->vi->numFrames, log_error);
+        if (!d->log) {
+            vsapi->mapSetError(out, ("SSIMULACRA: " + log_error).c_str());
+            free_nodes(d.get(), vsapi);
+            return;
+        }
+    }
+
+    if (max_inflight < 0)
+        max_inflight = default_max_inflight(d->region.width / d->downscale, d->region.height / d->downscale, core, vsapi);
+
+    std::vector<VSFilterDependency> deps{{d->node, rpGeneral}};
+    for (auto node2 : d->node2)
+        deps.push_back({node2, rpGeneral});
+
+    if (max_inflight > 0) {
+        const VSVideoInfo vi = *d->vi;
+        std::shared_ptr<void> data(d.release(), [vsapi](void* p) { ssimulacraFree(p, nullptr, vsapi); });
+        std::string lanes_error;
+        if (!create_metric_lanes(out, "SSIMULACRA", &vi, ssimulacraGetFrame, std::move(data), max_inflight, deps, lanes_error, core, vsapi))
+            vsapi->mapSetError(out, ("SSIMULACRA: " + lanes_error).c_str());
+        return;
     }
 
-    VSFilterDependency deps[]{{d->node, rpGeneral}, {d->node2, rpGeneral}};
-    vsapi->createVideoFilter(out, "SSIMULACRA", d->vi, ssimulacraGetFrame, ssimulacraFree, fmParallel, deps, 2, d.get(), core);
+    vsapi->createVideoFilter(out, "SSIMULACRA", d->vi, ssimulacraGetFrame, ssimulacraFree, fmParallel, deps.data(), static_cast<int>(deps.size()), d.get(), core);
     d.release();
 }
\ No newline at end of file
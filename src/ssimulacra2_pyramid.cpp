@@ -0,0 +1,265 @@
+#include "shared.h"
+
+// SSIMULACRA2 as in tools/ssimulacra2.cc, split so that everything that only depends on the reference
+// (XYB conversion, mean and variance at every scale) is computed once and shared between distorted images.
+
+constexpr int kNumScales = 6;
+constexpr float kC2 = 0.0009f;
+constexpr float kSigma = 1.5f;
+
+// Opsin absorbance matrix and bias of the XYB color space.
+constexpr float kM00 = 0.30f, kM01 = 0.622f, kM02 = 0.078f;
+constexpr float kM10 = 0.23f, kM11 = 0.692f, kM12 = 0.078f;
+constexpr float kM20 = 0.24342268924547819f, kM21 = 0.20476744424496821f, kM22 = 0.55180986650955360f;
+constexpr float kOpsinBias = 0.0037930732552754493f;
+
+static FORCE_INLINE double quartic(double x) noexcept {
+    x *= x;
+    return x * x;
+}
+
+// Linear sRGB -> XYB, already shifted to the positive range SSIMULACRA2 works with.
+static void to_positive_xyb(const PlaneView3& linear, jxl::Image3F& xyb) noexcept {
+    const float bias_cbrt = std::cbrt(kOpsinBias);
+    const size_t width = linear.xsize;
+    const size_t height = linear.ysize;
+
+    for (size_t y = 0; y < height; y++) {
+        const float* VS_RESTRICT row_r = linear.Row(0, y);
+        const float* VS_RESTRICT row_g = linear.Row(1, y);
+        const float* VS_RESTRICT row_b = linear.Row(2, y);
+        float* VS_RESTRICT row_x = xyb.PlaneRow(0, y);
+        float* VS_RESTRICT row_y = xyb.PlaneRow(1, y);
+        float* VS_RESTRICT row_bb = xyb.PlaneRow(2, y);
+
+        for (size_t x = 0; x < width; x++) {
+            const float r = row_r[x];
+            const float g = row_g[x];
+            const float b = row_b[x];
+            const float m0 = std::cbrt(std::max(kM00 * r + kM01 * g + kM02 * b + kOpsinBias, 0.0f)) - bias_cbrt;
+            const float m1 = std::cbrt(std::max(kM10 * r + kM11 * g + kM12 * b + kOpsinBias, 0.0f)) - bias_cbrt;
+            const float m2 = std::cbrt(std::max(kM20 * r + kM21 * g + kM22 * b + kOpsinBias, 0.0f)) - bias_cbrt;
+            const float vx = 0.5f * (m0 - m1);
+            const float vy = 0.5f * (m0 + m1);
+
+            row_x[x] = vx * 14.0f + 0.42f;
+            row_y[x] = vy + 0.01f;
+            row_bb[x] = (m2 - vy) + 0.55f;
+        }
+    }
+}
+
+static jxl::Status downsample(JxlMemoryManager* mm, const PlaneView3& in, jxl::Image3F& out) {
+    const size_t out_w = (in.xsize + 1) / 2;
+    const size_t out_h = (in.ysize + 1) / 2;
+    JXL_RETURN_IF_ERROR(ensure_size(mm, out, out_w, out_h));
+
+    for (size_t c = 0; c < 3; c++) {
+        for (size_t oy = 0; oy < out_h; oy++) {
+            const float* row0 = in.Row(c, std::min(oy * 2, in.ysize - 1));
+            const float* row1 = in.Row(c, std::min(oy * 2 + 1, in.ysize - 1));
+            float* VS_RESTRICT row_out = out.PlaneRow(c, oy);
+
+            for (size_t ox = 0; ox < out_w; ox++) {
+                const size_t x0 = std::min(ox * 2, in.xsize - 1);
+                const size_t x1 = std::min(ox * 2 + 1, in.xsize - 1);
+                row_out[ox] = (row0[x0] + row0[x1] + row1[x0] + row1[x1]) * 0.25f;
+            }
+        }
+    }
+    return true;
+}
+
+static void multiply(const jxl::Image3F& a, const jxl::Image3F& b, jxl::Image3F& out) noexcept {
+    for (size_t c = 0; c < 3; c++) {
+        for (size_t y = 0; y < a.ysize(); y++) {
+            const float* VS_RESTRICT row_a = a.ConstPlaneRow(c, y);
+            const float* VS_RESTRICT row_b = b.ConstPlaneRow(c, y);
+            float* VS_RESTRICT row_out = out.PlaneRow(c, y);
+
+            for (size_t x = 0; x < a.xsize(); x++) {
+                row_out[x] = row_a[x] * row_b[x];
+            }
+        }
+    }
+}
+
+// The blur temp plane and the recursive gaussian are kept in the scratch and shrunk to each scale.
+static jxl::Status blur(SSIMULACRA2Scratch& scratch, const jxl::Image3F& in, jxl::Image3F& out) {
+    if (!scratch.rg) {
+        scratch.rg = jxl::CreateRecursiveGaussian(kSigma);
+    }
+    if (scratch.blur_w < in.xsize() || scratch.blur_h < in.ysize()) {
+        JXL_ASSIGN_OR_RETURN(scratch.blur_temp, jxl::ImageF::Create(scratch.memory_manager, in.xsize(), in.ysize()));
+        scratch.blur_w = in.xsize();
+        scratch.blur_h = in.ysize();
+    }
+    scratch.blur_temp.ShrinkTo(in.xsize(), in.ysize());
+    JXL_RETURN_IF_ERROR(ensure_size(scratch.memory_manager, out, in.xsize(), in.ysize()));
+
+    jxl::ImageF& temp = scratch.blur_temp;
+    for (size_t c = 0; c < 3; c++) {
+        const jxl::ImageF& in_plane = in.Plane(c);
+        jxl::ImageF& out_plane = out.Plane(c);
+        JXL_RETURN_IF_ERROR(jxl::FastGaussian(
+            scratch.memory_manager, *scratch.rg, in.xsize(), in.ysize(),
+            [&](size_t y) { return in_plane.ConstRow(y); },
+            [&](size_t y) { return temp.Row(y); },
+            [&](size_t y) { return out_plane.Row(y); }));
+    }
+    return true;
+}
+
+// error_map, when given, gets the per pixel error averaged over the three planes.
+static void ssim_map(const SSIMULACRA2Scale& ref, const jxl::Image3F& mu2, const jxl::Image3F& sigma2_sq, const jxl::Image3F& sigma12, double* plane_averages, jxl::ImageF* error_map) noexcept {
+    const double one_per_pixels = 1.0 / (ref.mu.xsize() * ref.mu.ysize());
+
+    for (size_t c = 0; c < 3; c++) {
+        double sum[2] = {0.0, 0.0};
+
+        for (size_t y = 0; y < ref.mu.ysize(); y++) {
+            const float* row_m1 = ref.mu.ConstPlaneRow(c, y);
+            const float* row_m2 = mu2.ConstPlaneRow(c, y);
+            const float* row_s11 = ref.sigma_sq.ConstPlaneRow(c, y);
+            const float* row_s22 = sigma2_sq.ConstPlaneRow(c, y);
+            const float* row_s12 = sigma12.ConstPlaneRow(c, y);
+            float* row_e = error_map ? error_map->Row(y) : nullptr;
+
+            for (size_t x = 0; x < ref.mu.xsize(); x++) {
+                const float mu1 = row_m1[x];
+                const float mu2v = row_m2[x];
+                const float mu11 = mu1 * mu1;
+                const float mu22 = mu2v * mu2v;
+                const float mu12 = mu1 * mu2v;
+                // The luma term drops the (mu1^2 + mu2^2) denominator of the original SSIM, the values are already
+                // perceptually uniform so it would only overweight errors in the darks.
+                const float num_m = 1.0f - (mu1 - mu2v) * (mu1 - mu2v);
+                const float num_s = 2.0f * (row_s12[x] - mu12) + kC2;
+                const float denom_s = (row_s11[x] - mu11) + (row_s22[x] - mu22) + kC2;
+                const double d = std::max(1.0 - (num_m * num_s / denom_s), 0.0);
+
+                sum[0] += d;
+                sum[1] += quartic(d);
+                if (row_e)
+                    row_e[x] = (c ? row_e[x] : 0.0f) + static_cast<float>(d * (1.0 / 3.0));
+            }
+        }
+        plane_averages[c * 2] = one_per_pixels * sum[0];
+        plane_averages[c * 2 + 1] = std::sqrt(std::sqrt(one_per_pixels * sum[1]));
+    }
+}
+
+static void edge_diff_map(const SSIMULACRA2Scale& ref, const jxl::Image3F& img2, const jxl::Image3F& mu2, double* plane_averages) noexcept {
+    const double one_per_pixels = 1.0 / (ref.img.xsize() * ref.img.ysize());
+
+    for (size_t c = 0; c < 3; c++) {
+        double sum[4] = {0.0, 0.0, 0.0, 0.0};
+
+        for (size_t y = 0; y < ref.img.ysize(); y++) {
+            const float* row1 = ref.img.ConstPlaneRow(c, y);
+            const float* row2 = img2.ConstPlaneRow(c, y);
+            const float* row_m1 = ref.mu.ConstPlaneRow(c, y);
+            const float* row_m2 = mu2.ConstPlaneRow(c, y);
+
+            for (size_t x = 0; x < ref.img.xsize(); x++) {
+                const double d1 = (1.0 + std::abs(row2[x] - row_m2[x])) / (1.0 + std::abs(row1[x] - row_m1[x])) - 1.0;
+                // d1 > 0: edges in the distorted image where the reference is smooth (ringing, banding, blocking)
+                const double artifact = std::max(d1, 0.0);
+                // d1 < 0: edges in the reference that the distorted image lost (blurring, smearing)
+                const double detail_lost = std::max(-d1, 0.0);
+
+                sum[0] += artifact;
+                sum[1] += quartic(artifact);
+                sum[2] += detail_lost;
+                sum[3] += quartic(detail_lost);
+            }
+        }
+        plane_averages[c * 4] = one_per_pixels * sum[0];
+        plane_averages[c * 4 + 1] = std::sqrt(std::sqrt(one_per_pixels * sum[1]));
+        plane_averages[c * 4 + 2] = one_per_pixels * sum[2];
+        plane_averages[c * 4 + 3] = std::sqrt(std::sqrt(one_per_pixels * sum[3]));
+    }
+}
+
+// The full resolution input is only read, so it can come straight from an RGBS frame without a copy.
+// Images already held by ref and scratch are reused when the frame size doesn't change.
+jxl::Status ssimulacra2_reference(const PlaneView3& linear, SSIMULACRA2Reference& ref, SSIMULACRA2Scratch& scratch) {
+    size_t num_scales = 0;
+    PlaneView3 current = linear;
+
+    for (int scale = 0; scale < kNumScales; scale++) {
+        if (current.xsize < 8 || current.ysize < 8) {
+            break;
+        }
+        if (scratch.scales.size() <= static_cast<size_t>(scale)) {
+            scratch.scales.emplace_back();
+        }
+        SSIMULACRA2ScratchScale& tmp = scratch.scales[scale];
+        if (scale) {
+            JXL_RETURN_IF_ERROR(downsample(scratch.memory_manager, current, tmp.downscaled));
+            current = image_view(tmp.downscaled);
+        }
+
+        if (ref.scales.size() <= static_cast<size_t>(scale)) {
+            ref.scales.emplace_back();
+        }
+        SSIMULACRA2Scale& s = ref.scales[scale];
+        JXL_RETURN_IF_ERROR(ensure_size(scratch.memory_manager, s.img, current.xsize, current.ysize));
+        JXL_RETURN_IF_ERROR(ensure_size(scratch.memory_manager, tmp.mul, current.xsize, current.ysize));
+        to_positive_xyb(current, s.img);
+
+        multiply(s.img, s.img, tmp.mul);
+        JXL_RETURN_IF_ERROR(blur(scratch, tmp.mul, s.sigma_sq));
+        JXL_RETURN_IF_ERROR(blur(scratch, s.img, s.mu));
+        num_scales++;
+    }
+    ref.scales.resize(num_scales);
+    return true;
+}
+
+jxl::StatusOr<Msssim> ssimulacra2_compare(const SSIMULACRA2Reference& ref, const PlaneView3& linear, SSIMULACRA2Scratch& scratch, jxl::ImageF* error_map) {
+    Msssim msssim;
+    msssim.scales.reserve(ref.scales.size());
+
+    PlaneView3 current = linear;
+
+    for (size_t scale = 0; scale < ref.scales.size(); scale++) {
+        const SSIMULACRA2Scale& r = ref.scales[scale];
+        if (scratch.scales.size() <= scale) {
+            scratch.scales.emplace_back();
+        }
+        SSIMULACRA2ScratchScale& tmp = scratch.scales[scale];
+        if (scale) {
+            JXL_RETURN_IF_ERROR(downsample(scratch.memory_manager, current, tmp.downscaled));
+            current = image_view(tmp.downscaled);
+        }
+
+        if (current.xsize != r.img.xsize() || current.ysize != r.img.ysize()) {
+            return JXL_FAILURE("SSIMULACRA2: reference and distorted image sizes differ");
+        }
+
+        JXL_RETURN_IF_ERROR(ensure_size(scratch.memory_manager, tmp.img2, current.xsize, current.ysize));
+        JXL_RETURN_IF_ERROR(ensure_size(scratch.memory_manager, tmp.mul, current.xsize, current.ysize));
+        to_positive_xyb(current, tmp.img2);
+
+        multiply(tmp.img2, tmp.img2, tmp.mul);
+        JXL_RETURN_IF_ERROR(blur(scratch, tmp.mul, tmp.sigma2_sq));
+        multiply(r.img, tmp.img2, tmp.mul);
+        JXL_RETURN_IF_ERROR(blur(scratch, tmp.mul, tmp.sigma12));
+        JXL_RETURN_IF_ERROR(blur(scratch, tmp.img2, tmp.mu2));
+
+        jxl::ImageF* scale_error_map = nullptr;
+        if (error_map && scale == 0) {
+            if (error_map->xsize() != current.xsize || error_map->ysize() != current.ysize) {
+                JXL_ASSIGN_OR_RETURN(*error_map, jxl::ImageF::Create(scratch.memory_manager, current.xsize, current.ysize));
+            }
+            scale_error_map = error_map;
+        }
+
+        MsssimScale sscale;
+        ssim_map(r, tmp.mu2, tmp.sigma2_sq, tmp.sigma12, sscale.avg_ssim, scale_error_map);
+        edge_diff_map(r, tmp.img2, tmp.mu2, sscale.avg_edgediff);
+        msssim.scales.push_back(sscale);
+    }
+    return msssim;
+}
@@ -23,3 +23,19 @@ VSNode* toRGBS(VSNode* source, VSCore* core, const VSAPI* vsapi) {
 
     return out;
 }
+
+
+// Integer RGB and YUV are read directly by the metric fill functions, everything else goes through toRGBS.
+VSNode* toMetricInput(VSNode* source, VSCore* core, const VSAPI* vsapi) {
+    const VSVideoInfo* vi = vsapi->getVideoInfo(source);
+
+    if (vi->format.sampleType == stInteger && vi->format.bitsPerSample <= 16) {
+        if (vi->format.colorFamily == cfRGB)
+            return source;
+
+        if (vi->format.colorFamily == cfYUV && vi->format.subSamplingW <= 2 && vi->format.subSamplingH <= 2)
+            return source;
+    }
+
+    return toRGBS(source, core, vsapi);
+}
\ No newline at end of file
@@ -0,0 +1,259 @@
+#include "shared.h"
+
+// RGB primaries -> BT.709 primaries, both D65, derived from the chromaticity coordinates.
+static const float PRIMARIES_2020[9] = {1.6604910021f, -0.5876411388f, -0.0728498633f, -0.1245504745f, 1.1328998971f, -0.0083494226f, -0.0181507634f, -0.1005788980f, 1.1187296614f};
+static const float PRIMARIES_470BG[9] = {1.0440432088f, -0.0440432088f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0117933783f, 0.9882066217f};
+static const float PRIMARIES_170M[9] = {0.9395420638f, 0.0501813569f, 0.0102765794f, 0.0177722231f, 0.9657928625f, 0.0164349144f, -0.0016215999f, -0.0043697497f, 1.0059913496f};
+
+enum TransferCurve {
+    TRANSFER_SRGB,
+    TRANSFER_BT1886,
+    TRANSFER_GAMMA22,
+    TRANSFER_GAMMA28,
+    TRANSFER_LINEAR,
+    TRANSFER_COUNT
+};
+
+static float eotf(int curve, float v) noexcept {
+    switch (curve) {
+        case TRANSFER_SRGB:
+            return (v <= 0.04045f) ? v / 12.92f : std::pow((v + 0.055f) / 1.055f, 2.4f);
+        case TRANSFER_BT1886:
+            return std::pow(v, 2.4f);
+        case TRANSFER_GAMMA22:
+            return std::pow(v, 2.2f);
+        case TRANSFER_GAMMA28:
+            return std::pow(v, 2.8f);
+        default:
+            return v;
+    }
+}
+
+static const float* eotf_lut(int curve) noexcept {
+    static const auto luts = [] {
+        std::vector<std::vector<float>> tables(TRANSFER_COUNT, std::vector<float>(kTransferLUTSize + 1));
+        for (int c = 0; c < TRANSFER_COUNT; c++) {
+            for (int i = 0; i <= kTransferLUTSize; i++) {
+                tables[c][i] = eotf(c, static_cast<float>(i) / kTransferLUTSize);
+            }
+        }
+        return tables;
+    }();
+    return luts[curve].data();
+}
+
+bool yuv_conversion(YUVConversion& conv, const VSVideoFormat* fi, const VSMap* props, int height, const VSAPI* vsapi) noexcept {
+    int err;
+
+    int matrix = vsapi->mapGetIntSaturated(props, "_Matrix", 0, &err);
+    if (err)
+        matrix = VSC_MATRIX_UNSPECIFIED;
+
+    int range = vsapi->mapGetIntSaturated(props, "_ColorRange", 0, &err);
+    if (err)
+        range = VSC_RANGE_LIMITED;
+
+    int transfer = vsapi->mapGetIntSaturated(props, "_Transfer", 0, &err);
+    if (err)
+        transfer = VSC_TRANSFER_UNSPECIFIED;
+
+    int primaries = vsapi->mapGetIntSaturated(props, "_Primaries", 0, &err);
+    if (err)
+        primaries = VSC_PRIMARIES_UNSPECIFIED;
+
+    int chroma_loc = vsapi->mapGetIntSaturated(props, "_ChromaLocation", 0, &err);
+    if (err)
+        chroma_loc = VSC_CHROMA_LEFT;
+
+    return yuv_conversion(conv, fi, matrix, range, transfer, primaries, chroma_loc, height);
+}
+
+bool yuv_conversion(YUVConversion& conv, const VSVideoFormat* fi, int matrix, int range, int transfer, int primaries, int chroma_loc, int height) noexcept {
+    // HDR would need tone mapping to be compared on the SDR scale of the metrics, reading it as sRGB gives meaningless scores.
+    if (transfer == VSC_TRANSFER_ST2084 || transfer == VSC_TRANSFER_ARIB_B67)
+        return false;
+
+    // Other unknown or unsupported values fall back to what the resize.Bicubic based toRGBS used to assume:
+    // BT.709 for HD and BT.601 for SD, sRGB transfer and BT.709 primaries.
+    switch (matrix) {
+        case VSC_MATRIX_BT709:
+            conv.kr = 0.2126f;
+            conv.kb = 0.0722f;
+            break;
+        case VSC_MATRIX_FCC:
+            conv.kr = 0.30f;
+            conv.kb = 0.11f;
+            break;
+        case VSC_MATRIX_BT470_BG:
+        case VSC_MATRIX_ST170_M:
+            conv.kr = 0.299f;
+            conv.kb = 0.114f;
+            break;
+        case VSC_MATRIX_ST240_M:
+            conv.kr = 0.212f;
+            conv.kb = 0.087f;
+            break;
+        case VSC_MATRIX_BT2020_NCL:
+            conv.kr = 0.2627f;
+            conv.kb = 0.0593f;
+            break;
+        default:
+            conv.kr = (height > 650) ? 0.2126f : 0.299f;
+            conv.kb = (height > 650) ? 0.0722f : 0.114f;
+            break;
+    }
+
+    const float kg = 1.0f - conv.kr - conv.kb;
+    conv.cr_v = 2.0f * (1.0f - conv.kr);
+    conv.cb_u = 2.0f * (1.0f - conv.kb);
+    conv.cg_u = -2.0f * conv.kb * (1.0f - conv.kb) / kg;
+    conv.cg_v = -2.0f * conv.kr * (1.0f - conv.kr) / kg;
+
+    const int bits = fi->bitsPerSample;
+    if (range == VSC_RANGE_FULL) {
+        const float peak = static_cast<float>((1 << bits) - 1);
+        conv.y_offset = 0.0f;
+        conv.y_scale = 1.0f / peak;
+        conv.c_offset = static_cast<float>(1 << (bits - 1));
+        conv.c_scale = 1.0f / peak;
+    } else {
+        conv.y_offset = static_cast<float>(16 << (bits - 8));
+        conv.y_scale = 1.0f / (219 << (bits - 8));
+        conv.c_offset = static_cast<float>(128 << (bits - 8));
+        conv.c_scale = 1.0f / (224 << (bits - 8));
+    }
+
+    switch (transfer) {
+        case VSC_TRANSFER_BT709:
+        case VSC_TRANSFER_BT601:
+        case VSC_TRANSFER_BT2020_10:
+        case VSC_TRANSFER_BT2020_12:
+            conv.eotf = eotf_lut(TRANSFER_BT1886);
+            break;
+        case VSC_TRANSFER_BT470_M:
+            conv.eotf = eotf_lut(TRANSFER_GAMMA22);
+            break;
+        case VSC_TRANSFER_BT470_BG:
+            conv.eotf = eotf_lut(TRANSFER_GAMMA28);
+            break;
+        case VSC_TRANSFER_LINEAR:
+            conv.eotf = eotf_lut(TRANSFER_LINEAR);
+            break;
+        default:
+            conv.eotf = eotf_lut(TRANSFER_SRGB);
+            break;
+    }
+
+    switch (primaries) {
+        case VSC_PRIMARIES_BT2020:
+            conv.primaries = PRIMARIES_2020;
+            break;
+        case VSC_PRIMARIES_BT470_BG:
+            conv.primaries = PRIMARIES_470BG;
+            break;
+        case VSC_PRIMARIES_ST170_M:
+        case VSC_PRIMARIES_ST240_M:
+            conv.primaries = PRIMARIES_170M;
+            break;
+        default:
+            conv.primaries = nullptr;
+            break;
+    }
+
+    conv.ss_w = fi->subSamplingW;
+    conv.ss_h = fi->subSamplingH;
+
+    // Position of luma sample 0 on the chroma grid.
+    const float inv_w = 1.0f / (1 << conv.ss_w);
+    const float inv_h = 1.0f / (1 << conv.ss_h);
+    const bool center_x = chroma_loc == VSC_CHROMA_CENTER || chroma_loc == VSC_CHROMA_TOP || chroma_loc == VSC_CHROMA_BOTTOM;
+    conv.cx_offset = center_x ? (inv_w - 1.0f) * 0.5f : 0.0f;
+
+    if (chroma_loc == VSC_CHROMA_TOP_LEFT || chroma_loc == VSC_CHROMA_TOP) {
+        conv.cy_offset = 0.0f;
+    } else if (chroma_loc == VSC_CHROMA_BOTTOM_LEFT || chroma_loc == VSC_CHROMA_BOTTOM) {
+        conv.cy_offset = inv_h - 1.0f;
+    } else {
+        conv.cy_offset = (inv_h - 1.0f) * 0.5f;
+    }
+
+    conv.row = select_yuv_row();
+    return true;
+}
+
+template <typename pixel_t>
+static void load_row(const pixel_t* VS_RESTRICT srcp, float* VS_RESTRICT dstp, int width, float offset, float scale) noexcept {
+    for (int x = 0; x < width; x++) {
+        dstp[x] = (srcp[x] - offset) * scale;
+    }
+}
+
+template <typename pixel_t>
+void yuv_to_linear(jxl::Image3F& dst, const uint8_t* const srcp[3], const ptrdiff_t stride[3], int left, int top, int width, int height, int frame_width, int frame_height, const YUVConversion& conv, FillScratch& scratch) noexcept {
+    const int cw = (frame_width + (1 << conv.ss_w) - 1) >> conv.ss_w;
+    const int ch = (frame_height + (1 << conv.ss_h) - 1) >> conv.ss_h;
+    const float inv_w = 1.0f / (1 << conv.ss_w);
+    const float inv_h = 1.0f / (1 << conv.ss_h);
+
+    // Bilinear chroma upsampling, the horizontal taps are the same for every row.
+    // The buffers only grow, so a clip of constant size allocates them on its first frame.
+    scratch.x0.resize(width);
+    scratch.x1.resize(width);
+    scratch.wx.resize(width);
+    int* VS_RESTRICT x0 = scratch.x0.data();
+    int* VS_RESTRICT x1 = scratch.x1.data();
+    float* VS_RESTRICT wx = scratch.wx.data();
+    for (int x = 0; x < width; x++) {
+        const float pos = std::max((left + x) * inv_w + conv.cx_offset, 0.0f);
+        x0[x] = std::min(static_cast<int>(pos), cw - 1);
+        x1[x] = std::min(x0[x] + 1, cw - 1);
+        wx[x] = pos - static_cast<int>(pos);
+    }
+
+    // Only the chroma columns under the window are converted.
+    const int cx_begin = conv.ss_w ? x0[0] : left;
+    const int cx_end = conv.ss_w ? x1[width - 1] + 1 : left + width;
+
+    for (auto row : {&scratch.yrow, &scratch.urow, &scratch.vrow})
+        row->resize(width);
+    for (auto row : {&scratch.crow0, &scratch.crow1, &scratch.ctmp})
+        row->resize(cw);
+    std::vector<float>& yrow = scratch.yrow;
+    std::vector<float>& urow = scratch.urow;
+    std::vector<float>& vrow = scratch.vrow;
+    std::vector<float>& crow0 = scratch.crow0;
+    std::vector<float>& crow1 = scratch.crow1;
+    std::vector<float>& ctmp = scratch.ctmp;
+
+    for (int y = 0; y < height; y++) {
+        load_row(reinterpret_cast<const pixel_t*>(srcp[0] + (top + y) * stride[0]) + left, yrow.data(), width, conv.y_offset, conv.y_scale);
+
+        const float pos = std::max((top + y) * inv_h + conv.cy_offset, 0.0f);
+        const int y0 = std::min(static_cast<int>(pos), ch - 1);
+        const int y1 = std::min(y0 + 1, ch - 1);
+        const float wy = pos - static_cast<int>(pos);
+
+        for (int p = 1; p < 3; p++) {
+            load_row(reinterpret_cast<const pixel_t*>(srcp[p] + y0 * stride[p]) + cx_begin, crow0.data() + cx_begin, cx_end - cx_begin, conv.c_offset, conv.c_scale);
+            load_row(reinterpret_cast<const pixel_t*>(srcp[p] + y1 * stride[p]) + cx_begin, crow1.data() + cx_begin, cx_end - cx_begin, conv.c_offset, conv.c_scale);
+
+            for (int x = cx_begin; x < cx_end; x++) {
+                ctmp[x] = crow0[x] + wy * (crow1[x] - crow0[x]);
+            }
+
+            float* VS_RESTRICT out = (p == 1) ? urow.data() : vrow.data();
+            if (conv.ss_w) {
+                for (int x = 0; x < width; x++) {
+                    out[x] = ctmp[x0[x]] + wx[x] * (ctmp[x1[x]] - ctmp[x0[x]]);
+                }
+            } else {
+                memcpy(out, ctmp.data() + left, width * sizeof(float));
+            }
+        }
+
+        conv.row(yrow.data(), urow.data(), vrow.data(), dst.PlaneRow(0, y), dst.PlaneRow(1, y), dst.PlaneRow(2, y), width, conv);
+    }
+}
+
+template void yuv_to_linear<uint8_t>(jxl::Image3F& dst, const uint8_t* const srcp[3], const ptrdiff_t stride[3], int left, int top, int width, int height, int frame_width, int frame_height, const YUVConversion& conv, FillScratch& scratch) noexcept;
+template void yuv_to_linear<uint16_t>(jxl::Image3F& dst, const uint8_t* const srcp[3], const ptrdiff_t stride[3], int left, int top, int width, int height, int frame_width, int frame_height, const YUVConversion& conv, FillScratch& scratch) noexcept;
\ No newline at end of file
@@ -0,0 +1,38 @@
+// The banded Butteraugli path used with threads > 1 must give the same scores as comparing the full frame.
+
+#include <jxl/thread_parallel_runner.h>
+
+#include "test_util.h"
+
+int main() {
+    // Three bands of kMinBandRows, every band edge is inside the frame.
+    const size_t width = 64;
+    const size_t height = 3 * kMinBandRows + 100;
+    const double q = 2.0;
+
+    const jxl::Image3F ref = make_image(width, height, 1, false);
+    const jxl::Image3F dist = make_image(width, height, 2, true);
+
+    ButteraugliNorms full;
+    if (!full_norms(ref, dist, q, full)) {
+        fprintf(stderr, "full frame comparison failed\n");
+        return 1;
+    }
+
+    void* runner = JxlThreadParallelRunnerCreate(nullptr, 3);
+    std::vector<ButteraugliBand> bands;
+    make_bands(static_cast<int>(height), 3, bands);
+    jxl::ImageF banded_map;
+    const bool ok = runner && bands.size() == 3 && band_references(runner, test_params(), bands, ref) && band_diffmap(runner, bands, dist, banded_map);
+    if (runner)
+        JxlThreadParallelRunnerDestroy(runner);
+    if (!ok) {
+        fprintf(stderr, "banded comparison failed\n");
+        return 1;
+    }
+
+    if (!norms_close(full, compute_norms(banded_map, q), 1e-3))
+        return 1;
+    printf("banded Butteraugli matches the full frame\n");
+    return 0;
+}
\ No newline at end of file
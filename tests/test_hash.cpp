@@ -0,0 +1,43 @@
+// The content hash behind memo and cache_path must change when 32 byte stripes of a row are swapped.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "shared.h"
+
+int main() {
+    // 8 stripes of 4 values and a tail of 3, the same multiset of stripes in a different order must not collide.
+    double values[35];
+    for (int i = 0; i < 35; i++)
+        values[i] = i * 0.25 + 1.0;
+    const uint64_t base = hash_values(values, 35);
+
+    double swapped[35];
+    memcpy(swapped, values, sizeof(values));
+    for (int i = 0; i < 4; i++)
+        std::swap(swapped[i], swapped[12 + i]);
+    if (hash_values(swapped, 35) == base) {
+        fprintf(stderr, "swapping two stripes doesn't change the hash\n");
+        return 1;
+    }
+
+    // The tail word and the word in the same lane of an earlier stripe.
+    memcpy(swapped, values, sizeof(values));
+    std::swap(swapped[0], swapped[32]);
+    if (hash_values(swapped, 35) == base) {
+        fprintf(stderr, "swapping a stripe word with the tail doesn't change the hash\n");
+        return 1;
+    }
+
+    // Every stripe rotated by one.
+    memcpy(swapped, values, sizeof(values));
+    std::rotate(swapped, swapped + 4, swapped + 32);
+    if (hash_values(swapped, 35) == base) {
+        fprintf(stderr, "rotating the stripes doesn't change the hash\n");
+        return 1;
+    }
+
+    printf("permuted stripes hash differently\n");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+// The norms of a diff map holding NaN, inf and huge values must stay in range and match between C and AVX2.
+
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+#include "kernels.h"
+
+static bool same(double a, double b) noexcept {
+    if (a != a || b != b)
+        return a != a && b != b;
+    if (a == b)
+        return true;
+    return std::abs(a - b) <= 1e-5 * std::max(std::abs(a), std::abs(b));
+}
+
+int main() {
+    if (!julek_isa_supported(JULEK_ISA_AVX2)) {
+        printf("AVX2 isn't supported, nothing to compare\n");
+        return 0;
+    }
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    const float special[] = {nan, inf, -inf, 1e12f, -1e12f, 3e38f, -0.0f, 31.999f, 32.0f, -nan};
+
+    // Rows of 16 and more go through the vector loop, the rest through the C tail. The special values are
+    // placed in both parts and the largest rows only have the finite ones, so the sums can be compared too.
+    for (const int width : {7, 16, 40, 100}) {
+        for (const bool finite_only : {false, true}) {
+            std::vector<float> row(width);
+            for (int x = 0; x < width; x++)
+                row[x] = static_cast<float>((x * 37) % 101) / 16.0f - 3.0f;
+            for (int x = 0; x < width; x += 3) {
+                const float v = special[(x / 3) % 10];
+                if (!finite_only || (std::isfinite(v) && std::abs(v) < 1e6f))
+                    row[x] = v;
+            }
+
+            for (const double q : {2.0, 3.0, 6.0, 2.5}) {
+                NormAccumulator c, avx2;
+                select_norms_row(q, JULEK_ISA_C)(row.data(), width, static_cast<float>(q), c);
+                select_norms_row(q, JULEK_ISA_AVX2)(row.data(), width, static_cast<float>(q), avx2);
+
+                if (c.hist != avx2.hist || c.count != avx2.count || !same(c.max_val, avx2.max_val) || !same(c.sum_q, avx2.sum_q) ||
+                    !same(c.sum3, avx2.sum3)) {
+                    fprintf(stderr, "width %d q %g: C and AVX2 differ (max %g/%g, sum_q %g/%g, sum3 %g/%g)\n", width, q, c.max_val,
+                            avx2.max_val, c.sum_q, avx2.sum_q, c.sum3, avx2.sum3);
+                    return 1;
+                }
+                if (c.max_val != c.max_val) {
+                    fprintf(stderr, "width %d q %g: NaN leaked into the maximum\n", width, q);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    printf("norms match between C and AVX2\n");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+// The low memory strip mode (strip=) must stay within tolerance of comparing the full frame.
+
+#include <cstring>
+
+#include "test_util.h"
+
+int main() {
+    const size_t width = 64;
+    const size_t height = 1000;
+    const double q = 2.0;
+
+    const jxl::Image3F ref = make_image(width, height, 1, false);
+    const jxl::Image3F dist = make_image(width, height, 2, true);
+
+    ButteraugliNorms full;
+    if (!full_norms(ref, dist, q, full)) {
+        fprintf(stderr, "full frame comparison failed\n");
+        return 1;
+    }
+
+    // The smallest strip Butteraugli accepts, with a remainder so the last strip is shorter.
+    for (const int strip : {kMinStripRows, kMinStripRows + 100}) {
+        MetricWorkspace ws;
+        NormAccumulator acc;
+
+        auto fill = [&](jxl::Image3F& img, int clip, int top, int rows) {
+            const jxl::Image3F& src = (clip < 0) ? ref : dist;
+            for (size_t c = 0; c < 3; c++) {
+                for (int y = 0; y < rows; y++)
+                    memcpy(img.PlaneRow(c, y), src.ConstPlaneRow(c, top + y), width * sizeof(float));
+            }
+            return true;
+        };
+
+        auto add_rows = [&](int, const jxl::ImageF& map, int map_top, int y0, int y1) {
+            accumulate_norms(map, y0 - map_top, y1 - map_top, q, acc);
+        };
+
+        std::string error;
+        if (!strip_compare(static_cast<int>(width), static_cast<int>(height), strip, {0}, test_params(), ws, fill, add_rows, error)) {
+            fprintf(stderr, "strip %d: %s\n", strip, error.c_str());
+            return 1;
+        }
+
+        if (!norms_close(full, finish_norms(acc, q), 1e-3)) {
+            fprintf(stderr, "strip %d differs from the full frame\n", strip);
+            return 1;
+        }
+    }
+
+    printf("strip Butteraugli matches the full frame\n");
+    return 0;
+}
\ No newline at end of file
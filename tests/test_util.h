@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdio>
+
+#include "shared.h"
+
+// Smooth gradient with noise. The distorted image adds a brighter block a few hundred rows high, so it crosses the
+// band and strip edges.
+inline jxl::Image3F make_image(size_t width, size_t height, uint32_t seed, bool distorted) {
+    jxl::Image3F img = jxl::Image3F::Create(get_memory_manager(), width, height).value_();
+    uint32_t state = seed;
+    for (size_t c = 0; c < 3; c++) {
+        for (size_t y = 0; y < height; y++) {
+            float* row = img.PlaneRow(c, y);
+            for (size_t x = 0; x < width; x++) {
+                state = state * 1664525u + 1013904223u;
+                const float noise = static_cast<float>(state >> 8) / 16777216.0f - 0.5f;
+                float v = 0.2f + 0.6f * static_cast<float>(x + y) / static_cast<float>(width + height) + 0.02f * noise;
+                if (distorted && y >= height / 3 && y < height / 3 + 200 && x >= width / 4 && x < width / 2)
+                    v += 0.05f;
+                row[x] = v;
+            }
+        }
+    }
+    return img;
+}
+
+inline jxl::ButteraugliParams test_params() {
+    jxl::ButteraugliParams params;
+    params.hf_asymmetry = 0.8f;
+    params.xmul = 1.0f;
+    params.intensity_target = 203.0f;
+    return params;
+}
+
+// Butteraugli norms of dist against ref, comparing the full frames.
+inline bool full_norms(const jxl::Image3F& ref, const jxl::Image3F& dist, double q, ButteraugliNorms& norms) {
+    auto comparator = jxl::ButteraugliComparator::Make(ref, test_params());
+    jxl::ImageF diff_map;
+    if (!comparator.ok() || !std::move(comparator).value_()->Diffmap(dist, diff_map))
+        return false;
+    norms = compute_norms(diff_map, q);
+    return true;
+}
+
+// Relative tolerance for the norms, p95 and p99 are histogram bin edges and may move by one bin.
+inline bool norms_close(const ButteraugliNorms& expected, const ButteraugliNorms& actual, double tolerance) {
+    auto close = [tolerance](const char* name, double a, double b, double abs_tolerance) {
+        if (std::abs(a - b) <= std::max(tolerance * std::abs(a), abs_tolerance))
+            return true;
+        fprintf(stderr, "%s: expected %.9g, got %.9g\n", name, a, b);
+        return false;
+    };
+
+    const double bin = 1.0 / kNormBinScale;
+    bool pass = close("QNorm", expected.norm_q, actual.norm_q, 1e-6);
+    pass = close("3Norm", expected.norm3, actual.norm3, 1e-6) && pass;
+    pass = close("INFNorm", expected.norm_inf, actual.norm_inf, 1e-6) && pass;
+    pass = close("P95", expected.p95, actual.p95, bin) && pass;
+    pass = close("P99", expected.p99, actual.p99, bin) && pass;
+    return pass;
+}
\ No newline at end of file
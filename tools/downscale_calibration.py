@@ -0,0 +1,83 @@
+"""Compares the downscale=2/4 fast modes of julek.Butteraugli and julek.SSIMULACRA with full resolution scores.
+
+Usage:
+    python downscale_calibration.py reference.mkv distorted.mkv [--frames N] [--step S]
+
+Reports per metric and factor the Pearson and Spearman correlation with the full resolution scores and the speedup.
+Sources are opened with bs.VideoSource, or lsmas.LWLibavSource when BestSource isn't installed.
+"""
+
+import argparse
+import math
+import time
+
+import vapoursynth as vs
+
+core = vs.core
+
+
+def open_clip(path):
+    if hasattr(core, "bs"):
+        return core.bs.VideoSource(path)
+    return core.lsmas.LWLibavSource(path)
+
+
+def pearson(a, b):
+    n = len(a)
+    ma, mb = sum(a) / n, sum(b) / n
+    cov = sum((x - ma) * (y - mb) for x, y in zip(a, b))
+    va = sum((x - ma) ** 2 for x in a)
+    vb = sum((y - mb) ** 2 for y in b)
+    return cov / math.sqrt(va * vb) if va > 0 and vb > 0 else float("nan")
+
+
+def ranks(values):
+    order = sorted(range(len(values)), key=lambda i: values[i])
+    r = [0.0] * len(values)
+    i = 0
+    while i < len(order):
+        j = i
+        while j + 1 < len(order) and values[order[j + 1]] == values[order[i]]:
+            j += 1
+        for k in range(i, j + 1):
+            r[order[k]] = (i + j) / 2.0
+        i = j + 1
+    return r
+
+
+def scores(clip, prop):
+    start = time.perf_counter()
+    values = [f.props[prop] for f in clip.frames(close=True)]
+    return values, time.perf_counter() - start
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("reference")
+    parser.add_argument("distorted")
+    parser.add_argument("--frames", type=int, default=200, help="number of frames to score")
+    parser.add_argument("--step", type=int, default=1, help="score every step-th frame of the sources")
+    args = parser.parse_args()
+
+    ref = open_clip(args.reference)[:: args.step]
+    dist = open_clip(args.distorted)[:: args.step]
+    ref, dist = ref[: args.frames], dist[: args.frames]
+
+    # memo=0 so repeated runs over the same frames don't hit the score cache.
+    metrics = [
+        ("Butteraugli", "_BUTTERAUGLI_3Norm", lambda d: core.julek.Butteraugli(ref, dist, memo=0, downscale=d)),
+        ("SSIMULACRA2", "_SSIMULACRA2", lambda d: core.julek.SSIMULACRA(ref, dist, memo=0, downscale=d)),
+    ]
+
+    for name, prop, make in metrics:
+        full, full_time = scores(make(1), prop)
+        for factor in (2, 4):
+            fast, fast_time = scores(make(factor), prop)
+            print(
+                f"{name} downscale={factor}: pearson {pearson(full, fast):.4f}, "
+                f"spearman {pearson(ranks(full), ranks(fast)):.4f}, speedup {full_time / fast_time:.2f}x"
+            )
+
+
+if __name__ == "__main__":
+    main()
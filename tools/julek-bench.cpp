@@ -0,0 +1,485 @@
+// julek-bench: microbenchmark of the julek_kernels kernels on synthetic planes.
+//
+//     julek-bench [options]
+//
+// Every kernel runs at 720p, 1080p and 4K for each bit depth it supports, once per ISA the CPU can run. The output
+// of every ISA is checked against the C version: integer planes must be identical, float results may differ by
+// kFloatTolerance since the vector pow and the summation order change the last bits. Times are the median of the
+// repetitions, reported as GB/s (bytes read + written) and TSC cycles per pixel.
+//
+// --json writes one result per line, so two runs diff cleanly, and --baseline compares with such a file and fails
+// when a kernel got slower than --threshold.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define JULEK_BENCH_TSC
+#endif
+
+#include "julek_kernels.h"
+
+constexpr double kFloatTolerance = 1e-5;
+constexpr int kMinRepetitions = 3;
+constexpr int kMaxRepetitions = 1000;
+
+struct ISAInfo final {
+    JulekISA isa;
+    const char* name;
+};
+
+// The C entry must stay first, the others are checked against it.
+constexpr ISAInfo kISAs[] = {{JULEK_ISA_C, "c"}, {JULEK_ISA_AVX2, "avx2"}};
+
+struct Resolution final {
+    const char* name;
+    int width, height;
+};
+
+constexpr Resolution kResolutions[] = {{"720p", 1280, 720}, {"1080p", 1920, 1080}, {"4k", 3840, 2160}};
+
+struct Options final {
+    std::string filter;
+    std::vector<const Resolution*> sizes;
+    double min_time = 0.25;
+    const char* json = nullptr;
+    const char* baseline = nullptr;
+    double threshold = 10.0;
+};
+
+// Plane laid out like a VapourSynth frame plane: 64 byte aligned rows and a padded stride.
+class Plane final {
+   public:
+    Plane(int width, int height, int bits) : width(width), height(height), bits(bits) {
+        sample = (bits == 32) ? 4 : (bits > 8) ? 2 : 1;
+        stride = (static_cast<ptrdiff_t>(width) * sample + 63) & ~63;
+        data = static_cast<uint8_t*>(::operator new(stride * height, std::align_val_t(64)));
+        memset(data, 0, stride * height);
+    }
+    ~Plane() { ::operator delete(data, std::align_val_t(64)); }
+    Plane(const Plane&) = delete;
+    Plane& operator=(const Plane&) = delete;
+    Plane(Plane&& other) noexcept : width(other.width), height(other.height), bits(other.bits), sample(other.sample), stride(other.stride), data(other.data) { other.data = nullptr; }
+
+    uint8_t* row(int y) const noexcept { return data + y * stride; }
+    size_t bytes() const noexcept { return static_cast<size_t>(width) * height * sample; }
+
+    int width, height, bits, sample;
+    ptrdiff_t stride;
+    uint8_t* data;
+};
+
+// Gradient plus noise, so LUT kernels see every input value and min/max searches can't stop early.
+static void fill_synthetic(Plane& p, uint32_t seed, float float_scale) {
+    uint32_t state = seed * 2654435761u + 1;
+    const int peak = (p.bits == 32) ? 0 : (1 << p.bits) - 1;
+
+    for (int y = 0; y < p.height; y++) {
+        uint8_t* row = p.row(y);
+        for (int x = 0; x < p.width; x++) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            const float v = std::clamp(0.75f * (x + y) / (p.width + p.height) + 0.25f * (state >> 8) / 16777216.0f, 0.0f, 1.0f);
+
+            if (p.sample == 1)
+                row[x] = static_cast<uint8_t>(v * peak + 0.5f);
+            else if (p.sample == 2)
+                reinterpret_cast<uint16_t*>(row)[x] = static_cast<uint16_t>(v * peak + 0.5f);
+            else
+                reinterpret_cast<float*>(row)[x] = v * float_scale;
+        }
+    }
+}
+
+struct Buffers final {
+    std::vector<Plane> src;
+    std::vector<Plane> dst;
+    std::vector<double> values;  // results that aren't planes
+};
+
+struct Kernel final {
+    const char* name;
+    std::vector<int> bits;
+    void (*setup)(Buffers& b, const Resolution& res, int bits);
+    int (*run)(Buffers& b, JulekISA isa);
+};
+
+static const Kernel kKernels[] = {
+    {
+        "agm",
+        {8, 10, 16, 32},
+        [](Buffers& b, const Resolution& res, int bits) {
+            b.src.emplace_back(res.width, res.height, bits);
+            b.dst.emplace_back(res.width, res.height, bits);
+            fill_synthetic(b.src[0], 1, 1.0f);
+        },
+        [](Buffers& b, JulekISA isa) {
+            const Plane& s = b.src[0];
+            return julek_agm_mask(s.data, b.dst[0].data, s.stride, s.width, s.height, s.bits, 0.45f, 10.0f, isa);
+        },
+    },
+    {
+        "autogain",
+        {8, 10, 16, 32},
+        [](Buffers& b, const Resolution& res, int bits) {
+            b.src.emplace_back(res.width, res.height, bits);
+            b.dst.emplace_back(res.width, res.height, bits);
+            fill_synthetic(b.src[0], 2, 1.0f);
+        },
+        [](Buffers& b, JulekISA isa) {
+            const Plane& s = b.src[0];
+            return julek_autogain(s.data, b.dst[0].data, s.stride, s.width, s.height, s.bits, isa);
+        },
+    },
+    {
+        "colormap",
+        {8},
+        [](Buffers& b, const Resolution& res, int) {
+            b.src.emplace_back(res.width, res.height, 8);
+            for (int i = 0; i < 3; i++)
+                b.dst.emplace_back(res.width, res.height, 8);
+            fill_synthetic(b.src[0], 3, 1.0f);
+        },
+        [](Buffers& b, JulekISA) {
+            const Plane& s = b.src[0];
+            uint8_t* const dst[3] = {b.dst[0].data, b.dst[1].data, b.dst[2].data};
+            return julek_colormap(s.data, s.stride, dst, b.dst[0].stride, s.width, s.height, 20);
+        },
+    },
+    {
+        "rgb_to_linear",
+        {8, 10, 16, 32},
+        [](Buffers& b, const Resolution& res, int bits) {
+            for (int i = 0; i < 3; i++) {
+                b.src.emplace_back(res.width, res.height, bits);
+                b.dst.emplace_back(res.width, res.height, 32);
+                fill_synthetic(b.src[i], 4 + i, 1.0f);
+            }
+        },
+        [](Buffers& b, JulekISA isa) {
+            const void* src[3];
+            float* dst[3];
+            ptrdiff_t src_stride[3], dst_stride[3];
+            for (int i = 0; i < 3; i++) {
+                src[i] = b.src[i].data;
+                src_stride[i] = b.src[i].stride;
+                dst[i] = reinterpret_cast<float*>(b.dst[i].data);
+                dst_stride[i] = b.dst[i].stride;
+            }
+            return julek_rgb_to_linear(src, src_stride, b.src[0].bits, 0, dst, dst_stride, b.src[0].width, b.src[0].height, isa);
+        },
+    },
+    {
+        "butteraugli_norms",
+        {32},
+        [](Buffers& b, const Resolution& res, int) {
+            b.src.emplace_back(res.width, res.height, 32);
+            fill_synthetic(b.src[0], 7, 4.0f);
+        },
+        [](Buffers& b, JulekISA isa) {
+            const Plane& s = b.src[0];
+            JulekNorms norms;
+            const int ret = julek_butteraugli_norms(reinterpret_cast<const float*>(s.data), s.stride, s.width, s.height, 2.0, &norms, isa);
+            b.values = {norms.norm_q, norms.norm3, norms.norm_inf, norms.p95, norms.p99};
+            return ret;
+        },
+    },
+};
+
+static uint64_t read_tsc() noexcept {
+#ifdef JULEK_BENCH_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+struct Timing final {
+    double seconds;  // median per call
+    double cycles;   // median TSC cycles per call, 0 without a TSC
+};
+
+template <typename F>
+static Timing measure(F&& run, double min_time) {
+    using clock = std::chrono::steady_clock;
+    std::vector<double> seconds;
+    std::vector<double> cycles;
+
+    run();  // warm up caches and the lazily built tables
+    const auto start = clock::now();
+    while (seconds.size() < kMaxRepetitions && (seconds.size() < kMinRepetitions || std::chrono::duration<double>(clock::now() - start).count() < min_time)) {
+        const auto t0 = clock::now();
+        const uint64_t c0 = read_tsc();
+        run();
+        const uint64_t c1 = read_tsc();
+        seconds.push_back(std::chrono::duration<double>(clock::now() - t0).count());
+        cycles.push_back(static_cast<double>(c1 - c0));
+    }
+
+    auto median = [](std::vector<double>& v) {
+        std::nth_element(v.begin(), v.begin() + v.size() / 2, v.end());
+        return v[v.size() / 2];
+    };
+    return {median(seconds), median(cycles)};
+}
+
+// Largest difference between two runs over the visible part of the planes and the values.
+static double max_difference(const Buffers& a, const Buffers& b) noexcept {
+    double diff = 0.0;
+    for (size_t i = 0; i < a.dst.size(); i++) {
+        const Plane& p = a.dst[i];
+        for (int y = 0; y < p.height; y++) {
+            const uint8_t* ra = p.row(y);
+            const uint8_t* rb = b.dst[i].row(y);
+            for (int x = 0; x < p.width; x++) {
+                double va, vb;
+                if (p.sample == 1) {
+                    va = ra[x];
+                    vb = rb[x];
+                } else if (p.sample == 2) {
+                    va = reinterpret_cast<const uint16_t*>(ra)[x];
+                    vb = reinterpret_cast<const uint16_t*>(rb)[x];
+                } else {
+                    va = reinterpret_cast<const float*>(ra)[x];
+                    vb = reinterpret_cast<const float*>(rb)[x];
+                }
+                diff = std::max(diff, std::abs(va - vb) / std::max(1.0, std::abs(va)));
+            }
+        }
+    }
+    for (size_t i = 0; i < a.values.size(); i++)
+        diff = std::max(diff, std::abs(a.values[i] - b.values[i]) / std::max(1.0, std::abs(a.values[i])));
+    return diff;
+}
+
+static bool float_output(const Buffers& b) noexcept {
+    return !b.values.empty() || (!b.dst.empty() && b.dst[0].bits == 32);
+}
+
+struct Result final {
+    std::string name;
+    const char* kernel;
+    int bits;
+    const Resolution* res;
+    const char* isa;
+    Timing timing{};
+    double gbps = 0.0;
+    double cycles_per_pixel = 0.0;
+    double speedup = 0.0;  // against the C version
+    bool match = true;  // stays true when the C run is filtered out
+    double max_diff = 0.0;
+};
+
+static std::string bits_name(int bits) {
+    return (bits == 32) ? "float" : std::to_string(bits);
+}
+
+static void write_json(FILE* f, const std::vector<Result>& results) {
+    fputs("{\n  \"version\": 1,\n  \"results\": [\n", f);
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        fprintf(f,
+                "    {\"name\": \"%s\", \"kernel\": \"%s\", \"bits\": %d, \"width\": %d, \"height\": %d, \"isa\": \"%s\", "
+                "\"ms\": %.4f, \"gbps\": %.4f, \"cycles_per_pixel\": %.4f, \"match\": %s, \"max_diff\": %.3g}%s\n",
+                r.name.c_str(), r.kernel, r.bits, r.res->width, r.res->height, r.isa, r.timing.seconds * 1e3, r.gbps, r.cycles_per_pixel, r.match ? "true" : "false", r.max_diff, (i + 1 < results.size()) ? "," : "");
+    }
+    fputs("  ]\n}\n", f);
+}
+
+// Reads name -> GB/s from a file written by write_json, which has one result per line.
+static bool read_baseline(const char* path, std::map<std::string, double>& gbps) {
+    FILE* f = fopen(path, "r");
+    if (!f)
+        return false;
+
+    char line[1024];
+    while (fgets(line, sizeof(line), f)) {
+        const char* name = strstr(line, "\"name\": \"");
+        const char* value = strstr(line, "\"gbps\": ");
+        if (!name || !value)
+            continue;
+        name += 9;
+        const char* end = strchr(name, '"');
+        if (end)
+            gbps[std::string(name, end)] = atof(value + 8);
+    }
+    fclose(f);
+    return true;
+}
+
+static void usage() {
+    fputs(
+        "usage: julek-bench [options]\n"
+        "\n"
+        "  -f, --filter STR        only run the cases whose name (kernel/depth/size/isa) contains STR\n"
+        "  -s, --sizes LIST        720p,1080p,4k (default: all)\n"
+        "  -t, --min-time S        seconds spent on each case (default: 0.25)\n"
+        "      --json PATH         write the results as JSON\n"
+        "      --baseline PATH     compare with an earlier --json file\n"
+        "      --threshold PCT     GB/s drop against the baseline that counts as a regression (default: 10)\n",
+        stderr);
+}
+
+static bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : nullptr; };
+        const char* v = nullptr;
+
+        if (arg == "-f" || arg == "--filter") {
+            if (!(v = value()))
+                return false;
+            opt.filter = v;
+        } else if (arg == "-s" || arg == "--sizes") {
+            if (!(v = value()))
+                return false;
+            std::string list = v;
+            size_t pos = 0;
+            while (pos <= list.size()) {
+                const size_t comma = std::min(list.find(',', pos), list.size());
+                const std::string name = list.substr(pos, comma - pos);
+                auto it = std::find_if(std::begin(kResolutions), std::end(kResolutions), [&](const Resolution& r) { return name == r.name; });
+                if (it == std::end(kResolutions)) {
+                    fprintf(stderr, "julek-bench: unknown size \"%s\", expected 720p, 1080p or 4k.\n", name.c_str());
+                    return false;
+                }
+                opt.sizes.push_back(&*it);
+                pos = comma + 1;
+            }
+        } else if (arg == "-t" || arg == "--min-time") {
+            if (!(v = value()) || (opt.min_time = atof(v)) < 0.0)
+                return false;
+        } else if (arg == "--json") {
+            if (!(opt.json = value()))
+                return false;
+        } else if (arg == "--baseline") {
+            if (!(opt.baseline = value()))
+                return false;
+        } else if (arg == "--threshold") {
+            if (!(v = value()) || (opt.threshold = atof(v)) <= 0.0)
+                return false;
+        } else {
+            if (arg != "-h" && arg != "--help")
+                fprintf(stderr, "julek-bench: unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+
+    if (opt.sizes.empty()) {
+        for (const Resolution& r : kResolutions)
+            opt.sizes.push_back(&r);
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        usage();
+        return 1;
+    }
+
+    std::map<std::string, double> baseline;
+    if (opt.baseline && !read_baseline(opt.baseline, baseline)) {
+        fprintf(stderr, "julek-bench: can't read %s\n", opt.baseline);
+        return 1;
+    }
+
+    printf("%-18s %-6s %-6s %-5s %10s %9s %9s %8s  %s\n", "kernel", "depth", "size", "isa", "ms/call", "GB/s", "cyc/px", "vs c", "check");
+
+    std::vector<Result> results;
+    int mismatches = 0;
+    for (const Kernel& kernel : kKernels) {
+        for (const int bits : kernel.bits) {
+            for (const Resolution* res : opt.sizes) {
+                Buffers reference;
+                bool have_reference = false;
+                double c_seconds = 0.0;
+
+                for (const ISAInfo& isa : kISAs) {
+                    const std::string name = std::string(kernel.name) + "/" + bits_name(bits) + "/" + res->name + "/" + isa.name;
+                    if (!julek_isa_supported(isa.isa) || name.find(opt.filter) == std::string::npos)
+                        continue;
+
+                    Buffers b;
+                    kernel.setup(b, *res, bits);
+                    if (kernel.run(b, isa.isa)) {
+                        fprintf(stderr, "julek-bench: %s failed.\n", name.c_str());
+                        return 1;
+                    }
+
+                    Result r{name, kernel.name, bits, res, isa.name};
+                    r.timing = measure([&] { kernel.run(b, isa.isa); }, opt.min_time);
+
+                    size_t bytes = 0;
+                    for (const Plane& p : b.src)
+                        bytes += p.bytes();
+                    for (const Plane& p : b.dst)
+                        bytes += p.bytes();
+                    r.gbps = bytes / r.timing.seconds * 1e-9;
+                    r.cycles_per_pixel = r.timing.cycles / (static_cast<double>(res->width) * res->height);
+
+                    if (isa.isa == JULEK_ISA_C) {
+                        c_seconds = r.timing.seconds;
+                        reference = std::move(b);
+                        have_reference = true;
+                    } else if (have_reference) {
+                        r.max_diff = max_difference(reference, b);
+                        r.match = float_output(b) ? r.max_diff <= kFloatTolerance : r.max_diff == 0.0;
+                        r.speedup = c_seconds / r.timing.seconds;
+                    }
+                    mismatches += !r.match;
+
+                    char speedup[16] = "";
+                    if (r.speedup > 0.0)
+                        snprintf(speedup, sizeof(speedup), "x%.2f", r.speedup);
+                    printf("%-18s %-6s %-6s %-5s %10.3f %9.2f %9.3f %8s  %s\n", kernel.name, bits_name(bits).c_str(), res->name, isa.name, r.timing.seconds * 1e3, r.gbps, r.cycles_per_pixel, speedup, r.match ? "ok" : "MISMATCH");
+                    fflush(stdout);
+                    results.push_back(std::move(r));
+                }
+            }
+        }
+    }
+
+    if (opt.json) {
+        FILE* f = fopen(opt.json, "w");
+        if (!f) {
+            fprintf(stderr, "julek-bench: can't open %s for writing.\n", opt.json);
+            return 1;
+        }
+        write_json(f, results);
+        fclose(f);
+    }
+
+    int regressions = 0;
+    for (const Result& r : results) {
+        auto it = baseline.find(r.name);
+        if (it == baseline.end() || it->second <= 0.0)
+            continue;
+        const double change = (r.gbps / it->second - 1.0) * 100.0;
+        if (change < -opt.threshold) {
+            fprintf(stderr, "regression: %s %.2f GB/s, baseline %.2f GB/s (%.1f%%)\n", r.name.c_str(), r.gbps, it->second, change);
+            regressions++;
+        }
+    }
+
+    if (mismatches)
+        fprintf(stderr, "julek-bench: %d results differ from the C version.\n", mismatches);
+    if (regressions)
+        fprintf(stderr, "julek-bench: %d results are more than %.0f%% slower than the baseline.\n", regressions, opt.threshold);
+    return (mismatches || regressions) ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,515 @@
+// julek-filterbench: end-to-end benchmark of the julek filters in a VapourSynth core, without Python.
+//
+//     julek-filterbench [options]
+//
+// The VapourSynth library is loaded at run time, through getVapourSynthAPI or, for builds that only ship the script
+// library, VSScript's getVSAPI. Each filter gets a fresh core with autoloading disabled and the plugin loaded from
+// --plugin, so the numbers include the whole graph: synthetic std.BlankClip + std.Expr sources, the conversion to
+// RGBS, frame allocation and prop writing. Frames are pulled with getFrameAsync, keeping as many requests in flight
+// as the core has threads, like vspipe. Reports fps, per-frame latency percentiles and the peak RSS of each filter
+// (Linux only, the high water mark is reset between filters through /proc/self/clear_refs).
+//
+// The sources need std.Expr with X, Y and N, VapourSynth R58 or later.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include "vapoursynth/VSHelper4.h"
+#include "vapoursynth/VSScript4.h"
+#include "vapoursynth/VapourSynth4.h"
+
+#ifndef JULEK_PLUGIN_PATH
+#define JULEK_PLUGIN_PATH ""
+#endif
+
+#ifdef _WIN32
+constexpr const char* kCoreLibrary = "VapourSynth.dll";
+constexpr const char* kScriptLibrary = "VSScript.dll";
+constexpr const char* kNullDevice = "NUL";  // MetricSummary's summary file, not needed for timing
+#else
+constexpr const char* kCoreLibrary = "libvapoursynth.so";
+constexpr const char* kScriptLibrary = "libvapoursynth-script.so";
+constexpr const char* kNullDevice = "/dev/null";
+#endif
+
+using clock_type = std::chrono::steady_clock;
+
+struct SourceFormat final {
+    const char* name;
+    int color_family, sample_type, bits, ssw, ssh;
+};
+
+constexpr SourceFormat kFormats[] = {
+    {"yuv420p8", cfYUV, stInteger, 8, 1, 1},
+    {"yuv420p10", cfYUV, stInteger, 10, 1, 1},
+    {"yuv420p16", cfYUV, stInteger, 16, 1, 1},
+    {"yuv444p10", cfYUV, stInteger, 10, 0, 0},
+    {"yuv444ps", cfYUV, stFloat, 32, 0, 0},
+    {"rgb24", cfRGB, stInteger, 8, 0, 0},
+    {"rgb48", cfRGB, stInteger, 16, 0, 0},
+    {"rgbs", cfRGB, stFloat, 32, 0, 0},
+};
+
+struct Options final {
+    std::string plugin = JULEK_PLUGIN_PATH;
+    std::string library;
+    std::vector<std::string> filters;
+    const SourceFormat* format = &kFormats[1];
+    int width = 1920, height = 1080;
+    int frames = 100;
+    int warmup = 4;
+    int threads = 0;
+};
+
+static void* open_library(const char* path) {
+#ifdef _WIN32
+    return LoadLibraryA(path);
+#else
+    return dlopen(path, RTLD_NOW | RTLD_GLOBAL);
+#endif
+}
+
+static void* library_symbol(void* lib, const char* name) {
+#ifdef _WIN32
+    return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(lib), name));
+#else
+    return dlsym(lib, name);
+#endif
+}
+
+// VSAPI from the core library, or from the script library when only that one is found.
+static const VSAPI* load_vsapi(const std::string& path) {
+    using GetVSAPI = const VSAPI*(VS_CC*)(int);
+    using GetVSScriptAPI = const VSSCRIPTAPI*(VS_CC*)(int);
+
+    const char* core_path = path.empty() ? kCoreLibrary : path.c_str();
+    if (void* lib = open_library(core_path)) {
+        if (auto get = reinterpret_cast<GetVSAPI>(library_symbol(lib, "getVapourSynthAPI")))
+            return get(VAPOURSYNTH_API_VERSION);
+        if (auto get = reinterpret_cast<GetVSScriptAPI>(library_symbol(lib, "getVSScriptAPI"))) {
+            const VSSCRIPTAPI* vssapi = get(VSSCRIPT_API_VERSION);
+            return vssapi ? vssapi->getVSAPI(VAPOURSYNTH_API_VERSION) : nullptr;
+        }
+    }
+
+    if (path.empty()) {
+        if (void* lib = open_library(kScriptLibrary)) {
+            if (auto get = reinterpret_cast<GetVSScriptAPI>(library_symbol(lib, "getVSScriptAPI"))) {
+                const VSSCRIPTAPI* vssapi = get(VSSCRIPT_API_VERSION);
+                return vssapi ? vssapi->getVSAPI(VAPOURSYNTH_API_VERSION) : nullptr;
+            }
+        }
+    }
+    return nullptr;
+}
+
+// Peak resident set size in bytes since the last reset_peak_rss(), -1 when it can't be read.
+static int64_t peak_rss() {
+#ifdef __linux__
+    FILE* f = fopen("/proc/self/status", "r");
+    if (!f)
+        return -1;
+    char line[256];
+    int64_t kb = -1;
+    while (fgets(line, sizeof(line), f)) {
+        if (!strncmp(line, "VmHWM:", 6)) {
+            kb = atoll(line + 6);
+            break;
+        }
+    }
+    fclose(f);
+    return kb < 0 ? -1 : kb * 1024;
+#else
+    return -1;
+#endif
+}
+
+static void reset_peak_rss() {
+#ifdef __linux__
+    if (FILE* f = fopen("/proc/self/clear_refs", "w")) {
+        fputs("5", f);
+        fclose(f);
+    }
+#endif
+}
+
+// Takes ownership of the nodes passed in args, returns the "clip" of the result or nullptr with error set.
+static VSNode* invoke_clip(VSPlugin* plugin, const char* name, VSMap* args, std::string& error, const VSAPI* vsapi) {
+    VSMap* ret = vsapi->invoke(plugin, name, args);
+    vsapi->freeMap(args);
+
+    VSNode* node = nullptr;
+    if (const char* err = vsapi->mapGetError(ret))
+        error = std::string(name) + ": " + err;
+    else
+        node = vsapi->mapGetNode(ret, "clip", 0, nullptr);
+    vsapi->freeMap(ret);
+    return node;
+}
+
+// Per-pixel hash noise over a horizontal gradient, different on every frame. distorted adds a small second noise
+// on top of the reference, so the metrics have something to measure.
+static VSNode* make_source(const SourceFormat& fmt, const Options& opt, bool distorted, VSCore* core, std::string& error, const VSAPI* vsapi) {
+    VSPlugin* std_plugin = vsapi->getPluginByID(VSH_STD_PLUGIN_ID, core);
+
+    VSMap* args = vsapi->createMap();
+    vsapi->mapSetInt(args, "width", opt.width, maReplace);
+    vsapi->mapSetInt(args, "height", opt.height, maReplace);
+    vsapi->mapSetInt(args, "format", vsapi->queryVideoFormatID(fmt.color_family, fmt.sample_type, fmt.bits, fmt.ssw, fmt.ssh, core), maReplace);
+    vsapi->mapSetInt(args, "length", opt.warmup + opt.frames, maReplace);
+    VSNode* node = invoke_clip(std_plugin, "BlankClip", args, error, vsapi);
+    if (!node)
+        return nullptr;
+
+    const double peak = (fmt.sample_type == stFloat) ? 1.0 : (1 << fmt.bits) - 1;
+    char expr[512];
+    if (!distorted) {
+        snprintf(expr, sizeof(expr), "X 12.9898 * Y 78.233 * + N 0.618 * + sin 43758.5453 * dup floor - 0.4 * X %d / 0.6 * + %g *", opt.width, peak);
+    } else {
+        snprintf(expr, sizeof(expr), "X 12.9898 * Y 78.233 * + N 0.618 * + sin 43758.5453 * dup floor - 0.4 * X %d / 0.6 * + %g * X 39.346 * Y 11.135 * + N + sin 15731.743 * dup floor - 0.5 - %g * +", opt.width, peak, 0.03 * peak);
+    }
+
+    args = vsapi->createMap();
+    vsapi->mapConsumeNode(args, "clips", node, maReplace);
+    vsapi->mapSetData(args, "expr", expr, -1, dtUtf8, maReplace);
+    return invoke_clip(std_plugin, "Expr", args, error, vsapi);
+}
+
+struct Sources final {
+    VSNode* ref = nullptr;
+    VSNode* dist = nullptr;
+    VSNode* gray8_ref = nullptr;
+    VSNode* gray8_dist = nullptr;
+};
+
+struct FilterCase final {
+    const char* name;
+    // Builds the filter from the sources, consuming the references it takes.
+    std::function<VSNode*(VSPlugin* julek, const Sources& src, const Options& opt, std::string& error, const VSAPI* vsapi)> build;
+};
+
+static VSMap* clip_args(const char* key, VSNode* node, const VSAPI* vsapi) {
+    VSMap* args = vsapi->createMap();
+    vsapi->mapSetNode(args, key, node, maReplace);
+    return args;
+}
+
+static VSMap* pair_args(const char* key_a, VSNode* a, const char* key_b, VSNode* b, const VSAPI* vsapi) {
+    VSMap* args = clip_args(key_a, a, vsapi);
+    vsapi->mapSetNode(args, key_b, b, maReplace);
+    return args;
+}
+
+static const FilterCase kFilters[] = {
+    {"AGM", [](VSPlugin* julek, const Sources& s, const Options&, std::string& e, const VSAPI* vsapi) { return invoke_clip(julek, "AGM", clip_args("clip", s.ref, vsapi), e, vsapi); }},
+    {"AutoGain", [](VSPlugin* julek, const Sources& s, const Options&, std::string& e, const VSAPI* vsapi) { return invoke_clip(julek, "AutoGain", clip_args("clip", s.ref, vsapi), e, vsapi); }},
+    {"ColorMap", [](VSPlugin* julek, const Sources& s, const Options&, std::string& e, const VSAPI* vsapi) { return invoke_clip(julek, "ColorMap", clip_args("clip", s.gray8_ref, vsapi), e, vsapi); }},
+    {"VisualizeDiffs", [](VSPlugin* julek, const Sources& s, const Options&, std::string& e, const VSAPI* vsapi) { return invoke_clip(julek, "VisualizeDiffs", pair_args("clip_a", s.gray8_ref, "clip_b", s.gray8_dist, vsapi), e, vsapi); }},
+    {"RFS", [](VSPlugin* julek, const Sources& s, const Options& opt, std::string& e, const VSAPI* vsapi) {
+         VSMap* args = pair_args("clip_a", s.ref, "clip_b", s.dist, vsapi);
+         for (int n = 0; n < opt.warmup + opt.frames; n += 2)
+             vsapi->mapSetInt(args, "frames", n, maAppend);
+         return invoke_clip(julek, "RFS", args, e, vsapi);
+     }},
+    {"Butteraugli", [](VSPlugin* julek, const Sources& s, const Options&, std::string& e, const VSAPI* vsapi) { return invoke_clip(julek, "Butteraugli", pair_args("reference", s.ref, "distorted", s.dist, vsapi), e, vsapi); }},
+    {"SSIMULACRA", [](VSPlugin* julek, const Sources& s, const Options&, std::string& e, const VSAPI* vsapi) { return invoke_clip(julek, "SSIMULACRA", pair_args("reference", s.ref, "distorted", s.dist, vsapi), e, vsapi); }},
+    {"Metrics", [](VSPlugin* julek, const Sources& s, const Options&, std::string& e, const VSAPI* vsapi) { return invoke_clip(julek, "Metrics", pair_args("reference", s.ref, "distorted", s.dist, vsapi), e, vsapi); }},
+    {"MetricSummary", [](VSPlugin* julek, const Sources& s, const Options&, std::string& e, const VSAPI* vsapi) -> VSNode* {
+         VSMap* args = pair_args("reference", s.ref, "distorted", s.dist, vsapi);
+         vsapi->mapSetInt(args, "feature", 0, maReplace);
+         VSNode* scored = invoke_clip(julek, "SSIMULACRA", args, e, vsapi);
+         if (!scored)
+             return nullptr;
+         args = vsapi->createMap();
+         vsapi->mapConsumeNode(args, "clip", scored, maReplace);
+         vsapi->mapSetData(args, "props", "_SSIMULACRA2", -1, dtUtf8, maReplace);
+         vsapi->mapSetData(args, "path", kNullDevice, -1, dtUtf8, maReplace);
+         return invoke_clip(julek, "MetricSummary", args, e, vsapi);
+     }},
+};
+
+// Frames requested through getFrameAsync, keeping `requests` of them in flight.
+struct FramePuller final {
+    const VSAPI* vsapi;
+    VSNode* node;
+    int first, end;
+    int next = 0;
+    int outstanding = 0;
+    std::vector<clock_type::time_point> requested;
+    std::vector<double> latency;  // seconds, indexed by frame - first
+    std::string error;
+    std::mutex mutex;
+    std::condition_variable done;
+
+    FramePuller(const VSAPI* vsapi, VSNode* node, int first, int end) : vsapi(vsapi), node(node), first(first), end(end) {}
+
+    static void VS_CC frame_done(void* user_data, const VSFrame* f, int n, VSNode*, const char* error_msg) {
+        auto p{static_cast<FramePuller*>(user_data)};
+        const auto now = clock_type::now();
+        if (f)
+            p->vsapi->freeFrame(f);
+
+        std::unique_lock<std::mutex> lock(p->mutex);
+        p->latency[n - p->first] = std::chrono::duration<double>(now - p->requested[n - p->first]).count();
+        if (!f && p->error.empty())
+            p->error = "frame " + std::to_string(n) + ": " + (error_msg ? error_msg : "unknown error");
+        p->outstanding--;
+
+        if (p->error.empty() && p->next < p->end) {
+            const int m = p->next++;
+            p->requested[m - p->first] = clock_type::now();
+            p->outstanding++;
+            lock.unlock();
+            p->vsapi->getFrameAsync(m, p->node, frame_done, p);
+            return;
+        }
+        if (!p->outstanding)
+            p->done.notify_one();
+    }
+
+    // Returns the wall time in seconds, 0 with error set on failure.
+    double run(int requests) {
+        requested.resize(end - first);
+        latency.assign(end - first, 0.0);
+        next = first;
+
+        const auto start = clock_type::now();
+        std::vector<int> initial;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            while (next < end && static_cast<int>(initial.size()) < requests) {
+                requested[next - first] = clock_type::now();
+                initial.push_back(next++);
+                outstanding++;
+            }
+        }
+        for (const int n : initial)
+            vsapi->getFrameAsync(n, node, frame_done, this);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return outstanding == 0; });
+        return error.empty() ? std::chrono::duration<double>(clock_type::now() - start).count() : 0.0;
+    }
+};
+
+struct FilterResult final {
+    double fps;
+    double p50, p90, p99, max;  // latency in ms
+    int64_t rss;
+};
+
+static double percentile(const std::vector<double>& sorted, double p) {
+    const size_t i = std::min(sorted.size() - 1, static_cast<size_t>(p * (sorted.size() - 1) + 0.5));
+    return sorted[i];
+}
+
+static bool bench_filter(const VSAPI* vsapi, const FilterCase& filter, const Options& opt, FilterResult& result, std::string& error) {
+    reset_peak_rss();
+
+    VSCore* core = vsapi->createCore(ccfDisableAutoLoading);
+    if (!core) {
+        error = "failed to create a core.";
+        return false;
+    }
+    vsapi->setThreadCount(opt.threads, core);
+
+    VSMap* args = vsapi->createMap();
+    vsapi->mapSetData(args, "path", opt.plugin.c_str(), -1, dtUtf8, maReplace);
+    VSMap* ret = vsapi->invoke(vsapi->getPluginByID(VSH_STD_PLUGIN_ID, core), "LoadPlugin", args);
+    vsapi->freeMap(args);
+    if (const char* err = vsapi->mapGetError(ret))
+        error = std::string("LoadPlugin: ") + err;
+    vsapi->freeMap(ret);
+
+    VSPlugin* julek = vsapi->getPluginByNamespace("julek", core);
+    if (!julek && error.empty())
+        error = opt.plugin + " doesn't register the julek namespace.";
+
+    Sources src;
+    VSNode* node = nullptr;
+    if (error.empty()) {
+        constexpr SourceFormat kGray8{"gray8", cfGray, stInteger, 8, 0, 0};
+        src.ref = make_source(*opt.format, opt, false, core, error, vsapi);
+        src.dist = src.ref ? make_source(*opt.format, opt, true, core, error, vsapi) : nullptr;
+        src.gray8_ref = src.dist ? make_source(kGray8, opt, false, core, error, vsapi) : nullptr;
+        src.gray8_dist = src.gray8_ref ? make_source(kGray8, opt, true, core, error, vsapi) : nullptr;
+        if (src.gray8_dist)
+            node = filter.build(julek, src, opt, error, vsapi);
+    }
+    for (VSNode* n : {src.ref, src.dist, src.gray8_ref, src.gray8_dist}) {
+        if (n)
+            vsapi->freeNode(n);
+    }
+
+    double seconds = 0.0;
+    std::vector<double> latency;
+    if (node) {
+        VSCoreInfo info;
+        vsapi->getCoreInfo(core, &info);
+
+        char msg[1024] = "";
+        for (int n = 0; n < opt.warmup && !msg[0]; n++) {
+            if (const VSFrame* f = vsapi->getFrame(n, node, msg, sizeof(msg)))
+                vsapi->freeFrame(f);
+        }
+        if (msg[0])
+            error = msg;
+
+        if (error.empty()) {
+            FramePuller puller(vsapi, node, opt.warmup, opt.warmup + opt.frames);
+            seconds = puller.run(std::max(1, info.numThreads));
+            error = puller.error;
+            latency = std::move(puller.latency);
+        }
+        vsapi->freeNode(node);
+    }
+    vsapi->freeCore(core);
+
+    if (!error.empty())
+        return false;
+
+    std::sort(latency.begin(), latency.end());
+    result.fps = opt.frames / seconds;
+    result.p50 = percentile(latency, 0.50) * 1e3;
+    result.p90 = percentile(latency, 0.90) * 1e3;
+    result.p99 = percentile(latency, 0.99) * 1e3;
+    result.max = latency.back() * 1e3;
+    result.rss = peak_rss();
+    return true;
+}
+
+static void usage() {
+    fputs(
+        "usage: julek-filterbench [options]\n"
+        "\n"
+        "  -p, --plugin PATH       julek plugin to load (default: the one built with this tool)\n"
+        "      --vapoursynth PATH  VapourSynth core or script library (default: libvapoursynth.so, then libvapoursynth-script.so)\n"
+        "  -f, --filters LIST      comma separated, AGM,AutoGain,ColorMap,VisualizeDiffs,RFS,Butteraugli,SSIMULACRA,\n"
+        "                          Metrics,MetricSummary (default: all)\n"
+        "  -F, --format NAME       yuv420p8, yuv420p10, yuv420p16, yuv444p10, yuv444ps, rgb24, rgb48 or rgbs\n"
+        "                          (default: yuv420p10, ColorMap and VisualizeDiffs always use gray8)\n"
+        "  -s, --size WxH          frame size (default: 1920x1080)\n"
+        "  -n, --frames N          timed frames per filter (default: 100)\n"
+        "  -w, --warmup N          frames fetched before timing (default: 4)\n"
+        "  -t, --threads N         core threads and frames in flight, 0 for all CPUs (default: 0)\n",
+        stderr);
+}
+
+static bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : nullptr; };
+        const char* v = nullptr;
+
+        if (arg == "-p" || arg == "--plugin") {
+            if (!(v = value()))
+                return false;
+            opt.plugin = v;
+        } else if (arg == "--vapoursynth") {
+            if (!(v = value()))
+                return false;
+            opt.library = v;
+        } else if (arg == "-f" || arg == "--filters") {
+            if (!(v = value()))
+                return false;
+            const std::string list = v;
+            size_t pos = 0;
+            while (pos <= list.size()) {
+                const size_t comma = std::min(list.find(',', pos), list.size());
+                const std::string name = list.substr(pos, comma - pos);
+                if (std::none_of(std::begin(kFilters), std::end(kFilters), [&](const FilterCase& f) { return name == f.name; })) {
+                    fprintf(stderr, "julek-filterbench: unknown filter \"%s\".\n", name.c_str());
+                    return false;
+                }
+                opt.filters.push_back(name);
+                pos = comma + 1;
+            }
+        } else if (arg == "-F" || arg == "--format") {
+            if (!(v = value()))
+                return false;
+            auto it = std::find_if(std::begin(kFormats), std::end(kFormats), [&](const SourceFormat& f) { return !strcmp(v, f.name); });
+            if (it == std::end(kFormats)) {
+                fprintf(stderr, "julek-filterbench: unknown format \"%s\".\n", v);
+                return false;
+            }
+            opt.format = &*it;
+        } else if (arg == "-s" || arg == "--size") {
+            if (!(v = value()) || sscanf(v, "%dx%d", &opt.width, &opt.height) != 2 || opt.width < 16 || opt.height < 16)
+                return false;
+        } else if (arg == "-n" || arg == "--frames") {
+            if (!(v = value()) || (opt.frames = atoi(v)) < 1)
+                return false;
+        } else if (arg == "-w" || arg == "--warmup") {
+            if (!(v = value()) || (opt.warmup = atoi(v)) < 0)
+                return false;
+        } else if (arg == "-t" || arg == "--threads") {
+            if (!(v = value()) || (opt.threads = atoi(v)) < 0)
+                return false;
+        } else {
+            if (arg != "-h" && arg != "--help")
+                fprintf(stderr, "julek-filterbench: unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+
+    // Odd sizes don't fit the chroma subsampling of the source.
+    opt.width &= ~1;
+    opt.height &= ~1;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        usage();
+        return 1;
+    }
+    if (opt.plugin.empty()) {
+        fputs("julek-filterbench: no plugin given, use --plugin.\n", stderr);
+        return 1;
+    }
+
+    const VSAPI* vsapi = load_vsapi(opt.library);
+    if (!vsapi) {
+        fprintf(stderr, "julek-filterbench: can't load the VapourSynth API from %s.\n", opt.library.empty() ? kCoreLibrary : opt.library.c_str());
+        return 1;
+    }
+
+    printf("%s %dx%d, %d frames, %d threads\n", opt.format->name, opt.width, opt.height, opt.frames, opt.threads);
+    printf("%-15s %9s %10s %10s %10s %10s %10s\n", "filter", "fps", "p50 ms", "p90 ms", "p99 ms", "max ms", "peak MB");
+
+    int failures = 0;
+    for (const FilterCase& filter : kFilters) {
+        if (!opt.filters.empty() && std::find(opt.filters.begin(), opt.filters.end(), filter.name) == opt.filters.end())
+            continue;
+
+        FilterResult r;
+        std::string error;
+        if (!bench_filter(vsapi, filter, opt, r, error)) {
+            printf("%-15s failed: %s\n", filter.name, error.c_str());
+            failures++;
+            continue;
+        }
+
+        char rss[32] = "n/a";
+        if (r.rss >= 0)
+            snprintf(rss, sizeof(rss), "%.1f", r.rss / 1048576.0);
+        printf("%-15s %9.2f %10.2f %10.2f %10.2f %10.2f %10s\n", filter.name, r.fps, r.p50, r.p90, r.p99, r.max, rss);
+        fflush(stdout);
+    }
+    return failures ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,538 @@
+// julek-metrics: scores pairs of Y4M files with the metric code of the plugin, without a VapourSynth core.
+//
+//     julek-metrics [options] reference.y4m distorted.y4m
+//
+// Either file, but not both, can be "-" for stdin or a pipe. Frames are read in order, converted from YUV to linear RGB with the
+// plugin's own conversion and scored on a pool of worker threads, at most 2 frames per thread are held in memory.
+// Per-frame scores are printed to stdout as CSV, with the same column names as the frame props, and a summary of
+// every column goes to stderr.
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <thread>
+
+#include "shared.h"
+
+struct Options final {
+    bool butteraugli = true;
+    bool ssimulacra2 = true;
+    bool ssimulacra = true;
+    bool simple = false;
+    int threads = 0;
+    int max_frames = 0;
+    float intensity_target = 203.0f;
+    double qnorm = 2.0;
+    int matrix = VSC_MATRIX_UNSPECIFIED;
+    int transfer = VSC_TRANSFER_UNSPECIFIED;
+    int primaries = VSC_PRIMARIES_UNSPECIFIED;
+    int range = -1;  // from the Y4M header when not set
+    const char* reference = nullptr;
+    const char* distorted = nullptr;
+};
+
+struct Y4MReader final {
+    FILE* file = nullptr;
+    int width = 0, height = 0;
+    VSVideoFormat format{};
+    int chroma_loc = VSC_CHROMA_CENTER;
+    int range = VSC_RANGE_LIMITED;
+    int plane_w[3]{}, plane_h[3]{};
+    size_t frame_bytes = 0;
+
+    ~Y4MReader() {
+        if (file && file != stdin)
+            fclose(file);
+    }
+
+    bool read_line(std::string& line) {
+        line.clear();
+        int c;
+        while ((c = fgetc(file)) != EOF && c != '\n') {
+            if (line.size() >= 4096)
+                return false;
+            line.push_back(static_cast<char>(c));
+        }
+        return c == '\n';
+    }
+
+    // C tags: 420jpeg (the default), 420mpeg2, 420paldv, 420pN, 422, 422pN, 444 and 444pN.
+    bool parse_colorspace(const std::string& c) {
+        int ssw, ssh;
+        if (!c.compare(0, 3, "420")) {
+            ssw = ssh = 1;
+        } else if (!c.compare(0, 3, "422")) {
+            ssw = 1;
+            ssh = 0;
+        } else if (!c.compare(0, 3, "444")) {
+            ssw = ssh = 0;
+        } else {
+            return false;
+        }
+
+        const std::string rest = c.substr(3);
+        int bits = 8;
+        if (rest.empty() || rest == "jpeg") {
+            chroma_loc = VSC_CHROMA_CENTER;
+        } else if (rest == "mpeg2") {
+            chroma_loc = VSC_CHROMA_LEFT;
+        } else if (rest == "paldv") {
+            chroma_loc = VSC_CHROMA_TOP_LEFT;
+        } else if (rest[0] == 'p') {
+            bits = atoi(rest.c_str() + 1);
+            chroma_loc = VSC_CHROMA_LEFT;
+            if (bits < 8 || bits > 16)
+                return false;
+        } else {
+            return false;
+        }
+
+        format.colorFamily = cfYUV;
+        format.sampleType = stInteger;
+        format.bitsPerSample = bits;
+        format.bytesPerSample = (bits > 8) ? 2 : 1;
+        format.subSamplingW = ssw;
+        format.subSamplingH = ssh;
+        format.numPlanes = 3;
+        return true;
+    }
+
+    bool open(const char* path, std::string& error) {
+        file = strcmp(path, "-") ? fopen(path, "rb") : stdin;
+        if (!file) {
+            error = std::string(path) + ": can't open the file.";
+            return false;
+        }
+
+        std::string header;
+        if (!read_line(header) || header.compare(0, 10, "YUV4MPEG2 ")) {
+            error = std::string(path) + ": not a YUV4MPEG2 stream.";
+            return false;
+        }
+
+        bool colorspace = false;
+        size_t pos = 10;
+        while (pos < header.size()) {
+            size_t end = header.find(' ', pos);
+            if (end == std::string::npos)
+                end = header.size();
+            const std::string tag = header.substr(pos, end - pos);
+            pos = end + 1;
+            if (tag.empty())
+                continue;
+
+            if (tag[0] == 'W') {
+                width = atoi(tag.c_str() + 1);
+            } else if (tag[0] == 'H') {
+                height = atoi(tag.c_str() + 1);
+            } else if (tag[0] == 'C') {
+                if (!parse_colorspace(tag.substr(1))) {
+                    error = std::string(path) + ": unsupported colorspace " + tag.substr(1) + ".";
+                    return false;
+                }
+                colorspace = true;
+            } else if (tag == "XCOLORRANGE=FULL") {
+                range = VSC_RANGE_FULL;
+            } else if (tag == "XCOLORRANGE=LIMITED") {
+                range = VSC_RANGE_LIMITED;
+            }
+        }
+
+        if (!colorspace)
+            parse_colorspace("420jpeg");
+
+        if (width < 8 || height < 8) {
+            error = std::string(path) + ": minimum image size is 8x8 pixels.";
+            return false;
+        }
+
+        for (int p = 0; p < 3; p++) {
+            plane_w[p] = p ? (width + (1 << format.subSamplingW) - 1) >> format.subSamplingW : width;
+            plane_h[p] = p ? (height + (1 << format.subSamplingH) - 1) >> format.subSamplingH : height;
+            frame_bytes += static_cast<size_t>(plane_w[p]) * plane_h[p] * format.bytesPerSample;
+        }
+        return true;
+    }
+
+    // False at the end of the stream, with error set when the stream is broken.
+    bool read_frame(std::vector<uint8_t>& buffer, std::string& error) {
+        std::string line;
+        if (!read_line(line)) {
+            if (!line.empty())
+                error = "truncated FRAME header.";
+            return false;
+        }
+        if (line.compare(0, 5, "FRAME")) {
+            error = "expected a FRAME header.";
+            return false;
+        }
+
+        buffer.resize(frame_bytes);
+        if (fread(buffer.data(), 1, frame_bytes, file) != frame_bytes) {
+            error = "truncated frame.";
+            return false;
+        }
+        return true;
+    }
+};
+
+struct FrameJob final {
+    int n;
+    std::vector<uint8_t> ref, dist;
+};
+
+struct FrameScores final {
+    ButteraugliNorms norms{};
+    double ssimulacra2 = 0.0;
+    double ssimulacra = 0.0;
+    std::string error;
+};
+
+struct Scorer final {
+    const Options& opt;
+    const Y4MReader& reader;
+    YUVConversion conv{};
+    jxl::ButteraugliParams ba_params;
+    WorkspacePool workspaces;
+
+    Scorer(const Options& o, const Y4MReader& r) : opt(o), reader(r) {
+        const int range = (opt.range >= 0) ? opt.range : reader.range;
+        yuv_conversion(conv, &reader.format, opt.matrix, range, opt.transfer, opt.primaries, reader.chroma_loc, reader.height);
+        ba_params.hf_asymmetry = 0.8f;
+        ba_params.xmul = 1.0f;
+        ba_params.intensity_target = opt.intensity_target;
+    }
+
+    void fill(jxl::Image3F& img, const std::vector<uint8_t>& frame, FillScratch& scratch) const noexcept {
+        const uint8_t* planes[3];
+        ptrdiff_t stride[3];
+        const uint8_t* p = frame.data();
+        for (int i = 0; i < 3; i++) {
+            planes[i] = p;
+            stride[i] = static_cast<ptrdiff_t>(reader.plane_w[i]) * reader.format.bytesPerSample;
+            p += stride[i] * reader.plane_h[i];
+        }
+
+        if (reader.format.bytesPerSample == 1)
+            yuv_to_linear<uint8_t>(img, planes, stride, 0, 0, reader.width, reader.height, reader.width, reader.height, conv, scratch);
+        else
+            yuv_to_linear<uint16_t>(img, planes, stride, 0, 0, reader.width, reader.height, reader.width, reader.height, conv, scratch);
+    }
+
+    FrameScores score(const FrameJob& job) {
+        FrameScores s;
+        MetricWorkspace* ws = workspaces.acquire(reader.width, reader.height);
+        if (!ws) {
+            s.error = "failed to allocate image";
+            return s;
+        }
+
+        // Every metric works on linear light, so the pair is converted once and all of them read the same buffers.
+        fill(ws->ref, job.ref, ws->fill);
+        fill(ws->dist, job.dist, ws->fill);
+
+        if (opt.butteraugli) {
+            double score;
+            if (jxl::ButteraugliInterface(ws->ref, ws->dist, ba_params, ws->diff_map, score))
+                s.norms = compute_norms(ws->diff_map, opt.qnorm);
+            else
+                s.error = "ButteraugliInterface failed";
+        }
+
+        if (opt.ssimulacra2 && s.error.empty()) {
+            if (ssimulacra2_reference(image_view(ws->ref), ws->ref_pyramid, ws->scratch)) {
+                auto result = ssimulacra2_compare(ws->ref_pyramid, image_view(ws->dist), ws->scratch);
+                if (result.ok())
+                    s.ssimulacra2 = std::move(result).value_().Score();
+                else
+                    s.error = "ComputeSSIMULACRA2 failed";
+            } else {
+                s.error = "failed to build the SSIMULACRA2 reference";
+            }
+        }
+
+        if (opt.ssimulacra && s.error.empty()) {
+            auto result = ssimulacra::ComputeDiff(ws->ref, ws->dist, opt.simple);
+            if (result.ok())
+                s.ssimulacra = std::move(result).value_().Score();
+            else
+                s.error = "ssimulacra::ComputeDiff failed";
+        }
+
+        workspaces.release(ws);
+        return s;
+    }
+};
+
+static std::vector<double> score_row(const Options& opt, const FrameScores& s) {
+    std::vector<double> row;
+    if (opt.butteraugli)
+        row.insert(row.end(), {s.norms.norm_q, s.norms.norm3, s.norms.norm_inf, s.norms.p95, s.norms.p99});
+    if (opt.ssimulacra2)
+        row.push_back(s.ssimulacra2);
+    if (opt.ssimulacra)
+        row.push_back(s.ssimulacra);
+    return row;
+}
+
+static void usage() {
+    fputs(
+        "usage: julek-metrics [options] reference.y4m distorted.y4m\n"
+        "\n"
+        "  -m, --metrics LIST        butteraugli,ssimulacra2,ssimulacra (default: all)\n"
+        "  -t, --threads N           frames scored at the same time (default: number of CPUs)\n"
+        "  -n, --frames N            stop after N frames\n"
+        "      --intensity-target F  Butteraugli display brightness in nits (default: 203)\n"
+        "      --qnorm F             Butteraugli q-norm (default: 2)\n"
+        "      --simple              SSIMULACRA simple mode\n"
+        "      --matrix N            _Matrix value of the input (default: BT.709 for HD, BT.601 for SD)\n"
+        "      --transfer N          _Transfer value of the input (default: sRGB)\n"
+        "      --primaries N         _Primaries value of the input (default: BT.709)\n"
+        "      --range full|limited  override XCOLORRANGE of the Y4M header (default: the\n"
+        "                            header's, limited without one)\n",
+        stderr);
+}
+
+static bool parse_args(int argc, char** argv, Options& opt) {
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : nullptr; };
+
+        if (arg == "-m" || arg == "--metrics") {
+            const char* v = value();
+            if (!v)
+                return false;
+            opt.butteraugli = opt.ssimulacra2 = opt.ssimulacra = false;
+            std::string list = v;
+            size_t pos = 0;
+            while (pos <= list.size()) {
+                size_t end = list.find(',', pos);
+                if (end == std::string::npos)
+                    end = list.size();
+                const std::string metric = list.substr(pos, end - pos);
+                if (metric == "butteraugli") {
+                    opt.butteraugli = true;
+                } else if (metric == "ssimulacra2") {
+                    opt.ssimulacra2 = true;
+                } else if (metric == "ssimulacra") {
+                    opt.ssimulacra = true;
+                } else {
+                    fprintf(stderr, "julek-metrics: unknown metric \"%s\", expected butteraugli, ssimulacra2 or ssimulacra.\n", metric.c_str());
+                    return false;
+                }
+                pos = end + 1;
+            }
+        } else if (arg == "-t" || arg == "--threads") {
+            const char* v = value();
+            if (!v || (opt.threads = atoi(v)) < 1)
+                return false;
+        } else if (arg == "-n" || arg == "--frames") {
+            const char* v = value();
+            if (!v || (opt.max_frames = atoi(v)) < 1)
+                return false;
+        } else if (arg == "--intensity-target") {
+            const char* v = value();
+            if (!v || (opt.intensity_target = static_cast<float>(atof(v))) <= 0.0f)
+                return false;
+        } else if (arg == "--qnorm") {
+            const char* v = value();
+            if (!v || (opt.qnorm = atof(v)) <= 0.0)
+                return false;
+        } else if (arg == "--simple") {
+            opt.simple = true;
+        } else if (arg == "--matrix" || arg == "--transfer" || arg == "--primaries") {
+            const char* v = value();
+            if (!v)
+                return false;
+            (arg == "--matrix" ? opt.matrix : arg == "--transfer" ? opt.transfer : opt.primaries) = atoi(v);
+            if (opt.transfer == VSC_TRANSFER_ST2084 || opt.transfer == VSC_TRANSFER_ARIB_B67) {
+                fprintf(stderr, "julek-metrics: PQ and HLG (--transfer 16 and 18) aren't supported, convert the files to SDR first\n");
+                return false;
+            }
+        } else if (arg == "--range") {
+            const char* v = value();
+            if (!v || (strcmp(v, "full") && strcmp(v, "limited")))
+                return false;
+            opt.range = strcmp(v, "full") ? VSC_RANGE_LIMITED : VSC_RANGE_FULL;
+        } else if (arg == "-h" || arg == "--help") {
+            return false;
+        } else if (arg.size() > 1 && arg[0] == '-') {
+            fprintf(stderr, "julek-metrics: unknown option %s\n", arg.c_str());
+            return false;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+
+    if (files.size() != 2 || (!opt.butteraugli && !opt.ssimulacra2 && !opt.ssimulacra))
+        return false;
+    if (!strcmp(files[0], "-") && !strcmp(files[1], "-")) {
+        fprintf(stderr, "julek-metrics: only one of the files can be read from stdin.\n");
+        return false;
+    }
+    opt.reference = files[0];
+    opt.distorted = files[1];
+    if (opt.threads < 1)
+        opt.threads = std::max(1u, std::thread::hardware_concurrency());
+    return true;
+}
+
+static void print_summary(const std::vector<std::string>& columns, std::vector<std::vector<double>>& values, int frames, double seconds) {
+    fprintf(stderr, "%d frames in %.2f s (%.2f fps)\n", frames, seconds, seconds > 0.0 ? frames / seconds : 0.0);
+    if (!frames)
+        return;
+
+    for (size_t c = 0; c < columns.size(); c++) {
+        std::vector<double>& v = values[c];
+        std::sort(v.begin(), v.end());
+        double sum = 0.0;
+        for (const double x : v)
+            sum += x;
+        auto quantile = [&v](double q) { return v[std::min(v.size() - 1, static_cast<size_t>(q * v.size()))]; };
+        fprintf(stderr, "%-22s mean %10.5f  min %10.5f  p5 %10.5f  p50 %10.5f  p95 %10.5f  max %10.5f\n", columns[c].c_str(), sum / v.size(), v.front(), quantile(0.05), quantile(0.5), quantile(0.95), v.back());
+    }
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+
+    Y4MReader ref, dist;
+    std::string error;
+    if (!ref.open(opt.reference, error) || !dist.open(opt.distorted, error)) {
+        fprintf(stderr, "julek-metrics: %s\n", error.c_str());
+        return 1;
+    }
+
+    if (ref.width != dist.width || ref.height != dist.height || !vsh::isSameVideoFormat(&ref.format, &dist.format)) {
+        fprintf(stderr, "julek-metrics: both files must have the same format and dimensions.\n");
+        return 1;
+    }
+
+    std::vector<std::string> columns;
+    if (opt.butteraugli)
+        columns.insert(columns.end(), {"_BUTTERAUGLI_QNorm", "_BUTTERAUGLI_3Norm", "_BUTTERAUGLI_INFNorm", "_BUTTERAUGLI_P95", "_BUTTERAUGLI_P99"});
+    if (opt.ssimulacra2)
+        columns.push_back("_SSIMULACRA2");
+    if (opt.ssimulacra)
+        columns.push_back("_SSIMULACRA");
+
+    Scorer scorer(opt, ref);
+
+    // Jobs wait in a queue bounded by max_held, results are printed as soon as every earlier frame is done.
+    const size_t max_held = static_cast<size_t>(opt.threads) * 2;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<FrameJob> jobs;
+    std::map<int, FrameScores> done;
+    size_t running = 0;
+    bool finished = false;
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < opt.threads; i++) {
+        workers.emplace_back([&]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                cv.wait(lock, [&] { return finished || !jobs.empty(); });
+                if (jobs.empty())
+                    return;
+
+                FrameJob job = std::move(jobs.front());
+                jobs.pop_front();
+                running++;
+                lock.unlock();
+
+                const int n = job.n;
+                FrameScores s = scorer.score(job);
+                job = {};
+
+                lock.lock();
+                running--;
+                done.emplace(n, std::move(s));
+                cv.notify_all();
+            }
+        });
+    }
+
+    std::vector<std::vector<double>> values(columns.size());
+    int next = 0;
+    bool failed = false;
+
+    fputs("frame", stdout);
+    for (const auto& c : columns)
+        fprintf(stdout, ",%s", c.c_str());
+    fputc('\n', stdout);
+
+    // Prints the finished frames that are next in order, mutex must be held.
+    auto print_ready = [&]() {
+        for (auto it = done.begin(); it != done.end() && it->first == next; it = done.erase(it), next++) {
+            if (!it->second.error.empty()) {
+                fprintf(stderr, "julek-metrics: frame %d: %s\n", it->first, it->second.error.c_str());
+                failed = true;
+                continue;
+            }
+
+            const std::vector<double> row = score_row(opt, it->second);
+            fprintf(stdout, "%d", it->first);
+            for (size_t c = 0; c < row.size(); c++) {
+                fprintf(stdout, ",%.6f", row[c]);
+                values[c].push_back(row[c]);
+            }
+            fputc('\n', stdout);
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    int frames = 0;
+    while (!opt.max_frames || frames < opt.max_frames) {
+        FrameJob job;
+        job.n = frames;
+        std::string ref_error, dist_error;
+        const bool have_ref = ref.read_frame(job.ref, ref_error);
+        const bool have_dist = dist.read_frame(job.dist, dist_error);
+
+        if (!ref_error.empty() || !dist_error.empty()) {
+            fprintf(stderr, "julek-metrics: frame %d: %s\n", frames, (ref_error.empty() ? opt.distorted + (": " + dist_error) : opt.reference + (": " + ref_error)).c_str());
+            failed = true;
+            break;
+        }
+        if (!have_ref || !have_dist) {
+            if (have_ref != have_dist)
+                fprintf(stderr, "julek-metrics: %s ends after %d frames, the rest of the other file is ignored.\n", have_ref ? opt.distorted : opt.reference, frames);
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] {
+            print_ready();
+            return jobs.size() + running < max_held;
+        });
+        jobs.push_back(std::move(job));
+        cv.notify_all();
+        frames++;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished = true;
+        cv.notify_all();
+        cv.wait(lock, [&] {
+            print_ready();
+            return next == frames;
+        });
+    }
+    for (auto& w : workers)
+        w.join();
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    print_summary(columns, values, frames, seconds);
+    return failed ? 1 : 0;
+}
\ No newline at end of file